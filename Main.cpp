@@ -11,6 +11,7 @@ This file includes the entry point of the game.
 The functions include:
 - gsm_init
 - gsm_update
+- get_state_mem_tag
 
 Copyright (C) 2021 DigiPen Institure of Technology.
 Reproduction or disclosure of this file or its contents
@@ -23,14 +24,59 @@ Technology is prohibited.
 #include "audio.h"
 #include "player_data.h"
 #include "graphics.h"
+#include "broadphase.h"
+#include "attack.h"
+#include "level_arena.h"
+#include "collectables.h"
+#include "mem_tracker.h"
+#include "particlesystem.h"
 #include <memory>
 
 static char iconpath[] = "Sprites\\EXE_Icon.ico";
 AEVec2 god_mode_pos = { -(1280 / 2), -720 / 2 };
+#if defined(DEBUG) | defined(_DEBUG)
+AEVec2 benchmark_pos = { -(1280 / 2), -720 / 2 + 25 };
+AEVec2 collision_stats_pos = { -(1280 / 2), -720 / 2 + 50 };
+AEVec2 attack_pool_pos = { -(1280 / 2), -720 / 2 + 75 };
+AEVec2 level_arena_pos = { -(1280 / 2), -720 / 2 + 100 };
+AEVec2 collectable_pool_pos = { -(1280 / 2), -720 / 2 + 125 };
+AEVec2 mem_stats_pos = { -(1280 / 2), -720 / 2 + 150 };
+AEVec2 particle_stats_pos = { -(1280 / 2), -720 / 2 + 300 };
+AEVec2 particle_system_stats_pos = { -(1280 / 2), -720 / 2 + 325 };
+std::string benchmark_text;
+bool show_collision_stats = false;
+const char* broadphase_names[] = { "Grid", "Sweep", "Brute force" };
+#endif
 FMOD::System* sound_system;
 FMOD::Channel* channel = 0;
 FMOD_RESULT fmod_result;
 
+/******************************************************************************
+ * @brief Gets the memory tag of the allocations made by a game state. Levels
+ * are tagged as level loading while they load and initialize, and every other
+ * game state is UI.
+ *
+ * @param state
+ * Game state
+ * @param loading
+ * True while the game state is loading or initializing
+ * @return MEM_TAG
+ * Memory tag of the game state
+ *****************************************************************************/
+static MEM_TAG get_state_mem_tag(u32 state, bool loading)
+{
+	switch (state)
+	{
+	case GS_TUTORIAL:
+	case GS_LEVEL1:
+	case GS_LEVEL2:
+	case GS_LEVEL3:
+		return loading ? MEM_TAG::LEVEL_LOAD : MEM_TAG::OTHER;
+	default:
+		return MEM_TAG::UI;
+	}
+}
+
 /******************************************************************************
  * @brief Main function of the console application
  * Initializes the Alpha Engine System. Then, sets the icon of the game by
@@ -42,9 +88,14 @@ FMOD_RESULT fmod_result;
  * At this point, the game will initialize and be on a constant game loop.
  * Some system such as the time scale, options menu, and audio will update
  * regardless of the game state. God mode and hard capping of frame rate to 60
- *  will be done here as well. Upon quitting, fonts, option menu assets,
- * transition assets, and the audio system will be unloaded before the Alpha
- * Engine system is released, ending the console application.
+ *  will be done here as well. In debug builds, the collision benchmark can
+ * be run with the 9 key, and the 8 key shows the collision and memory counters
+ * and cycles through the broadphase methods. The 7 key turns the per frame
+ * allocation budgets on and off, the 6 key writes the memory counters to
+ * a CSV file, and the 5 key runs the particle benchmark. Upon quitting,
+ * fonts, option menu assets, transition assets, and the audio system will be
+ * unloaded before the Alpha Engine system is released, ending the console
+ * application.
  *
  * @param hInstance
  * Instance of this console application
@@ -97,14 +148,19 @@ int APIENTRY wWinMain(_In_ HINSTANCE hInstance,
 		else
 		{
 			gsm_update();
+			Mem_Scope mem_scope(get_state_mem_tag(gAEGameStateCurr, true));
 			AEGameStateLoad();
 			time_load();
 		}
-		AEGameStateInit();
-		time_initialize();
+		{
+			Mem_Scope mem_scope(get_state_mem_tag(gAEGameStateCurr, true));
+			AEGameStateInit();
+			time_initialize();
+		}
 		while (gAEGameStateCurr == gAEGameStateNext)
 		{
 			AESysFrameStart();
+			mem_tracker_frame_start();
 
 			if (GetFocus() != AESysGetWindowHandle())
 			{
@@ -114,19 +170,103 @@ int APIENTRY wWinMain(_In_ HINSTANCE hInstance,
 				AudioSystem::instance()->set_pause_group(AUDIO_GROUP::SFX, true);
 			}
 			AEInputUpdate();
-			AEGameStateUpdate();
-			time_update();
-			options_update();
-			AEGameStateDraw();
-			options_draw();
+			{
+				Mem_Scope mem_scope(get_state_mem_tag(gAEGameStateCurr, false));
+				AEGameStateUpdate();
+				time_update();
+			}
+			{
+				Mem_Scope mem_scope(MEM_TAG::UI);
+				options_update();
+			}
+			{
+				Mem_Scope mem_scope(get_state_mem_tag(gAEGameStateCurr, false));
+				AEGameStateDraw();
+			}
+			{
+				Mem_Scope mem_scope(MEM_TAG::UI);
+				options_draw();
+			}
 			if (god_mode)
 				text_print(desc_font, "God Mode On", &god_mode_pos);
+#if defined(DEBUG) | defined(_DEBUG)
+			if (!benchmark_text.empty())
+				text_print(desc_font, benchmark_text, &benchmark_pos);
+			if (show_collision_stats)
+			{
+				const Collision_Stats& stats = get_collision_stats();
+				char buffer[128];
+				sprintf_s(buffer, "%s: %u objects, %u/%u pairs tested, %u hits, %u allocations, %.3fms",
+					broadphase_names[static_cast<int>(stats.mode)], stats.objects + stats.static_objects,
+					stats.pairs_tested, stats.brute_force_pairs, stats.pairs_hit, stats.allocations, stats.time * 1000.0);
+				text_print(desc_font, buffer, &collision_stats_pos);
+				const Attack_Collider_Stats pool = get_attack_collider_stats();
+				sprintf_s(buffer, "Attack colliders: %u/%u in use, %u peak, %u overflow",
+					pool.in_use, pool.capacity, pool.peak, pool.overflow);
+				text_print(desc_font, buffer, &attack_pool_pos);
+				const Level_Arena_Stats& arena = get_level_arena_stats();
+				sprintf_s(buffer, "Level arena: %u allocations, %.1f/%.1fKB in %u blocks",
+					arena.allocations, arena.bytes / 1024.0, arena.reserved / 1024.0, arena.blocks);
+				text_print(desc_font, buffer, &level_arena_pos);
+				const Collectable_Stats drops = get_collectable_stats();
+				sprintf_s(buffer, "Collectables: %u/%u in use, %u peak, %u reused",
+					drops.in_use, drops.capacity, drops.peak, drops.reused);
+				text_print(desc_font, buffer, &collectable_pool_pos);
+				AEVec2 mem_pos = mem_stats_pos;
+				for (int i{ 0 }; i < static_cast<int>(MEM_TAG::TOTAL); ++i)
+				{
+					const Mem_Tag_Stats& mem = get_mem_tag_stats(static_cast<MEM_TAG>(i));
+					sprintf_s(buffer, "%s: %.1fKB live, %.1fKB peak, %u allocations last frame%s",
+						get_mem_tag_name(static_cast<MEM_TAG>(i)), mem.live_bytes / 1024.0, mem.peak_bytes / 1024.0,
+						mem.frame_allocations, mem.budget && mem_tracker_budgets_enforced() ? " (budget on)" : "");
+					text_print(desc_font, buffer, &mem_pos);
+					mem_pos.y += 25;
+				}
+				const Particle_Stats& particles = get_particle_stats();
+				sprintf_s(buffer, "Particles: %u/%u alive, %u peak, %u updated last frame",
+					particles.alive, particles.budget, particles.peak, particles.updated);
+				text_print(desc_font, buffer, &particle_stats_pos);
+				sprintf_s(buffer, "Particles: %u emitted, %u throttled, %u systems, %u reused",
+					particles.emitted, particles.throttled, particles.systems, particles.reused);
+				text_print(desc_font, buffer, &particle_system_stats_pos);
+			}
+#endif
 			AudioSystem::instance()->update();
 
+			mem_tracker_frame_end();
 			AESysFrameEnd();
 
 			if (AEInputCheckTriggered(AEVK_0))
 				god_mode = !god_mode;
+#if defined(DEBUG) | defined(_DEBUG)
+			if (AEInputCheckTriggered(AEVK_9))
+			{
+				Collision_Benchmark result = collision_benchmark(64, 10000);
+				char buffer[128];
+				sprintf_s(buffer, "AABB x%u: scalar %.2fms, batch %.2fms%s", result.boxes,
+					result.scalar_time * 1000.0, result.batch_time * 1000.0, result.results_match ? "" : ", MISMATCH");
+				benchmark_text = buffer;
+			}
+			if (AEInputCheckTriggered(AEVK_5))
+			{
+				Particle_Benchmark result = particle_benchmark(100000, 10);
+				char buffer[128];
+				sprintf_s(buffer, "Particles x%u: scalar %.2fms, batch %.2fms%s", result.particles,
+					result.scalar_time * 1000.0, result.batch_time * 1000.0, result.results_match ? "" : ", MISMATCH");
+				benchmark_text = buffer;
+			}
+			if (AEInputCheckTriggered(AEVK_8))
+			{
+				// First press shows the counters, every press after cycles the broadphase
+				if (show_collision_stats)
+					set_broadphase_mode(static_cast<BROADPHASE_MODE>((static_cast<int>(get_broadphase_mode()) + 1) % static_cast<int>(BROADPHASE_MODE::TOTAL)));
+				show_collision_stats = true;
+			}
+			if (AEInputCheckTriggered(AEVK_7))
+				mem_tracker_enforce_budgets(!mem_tracker_budgets_enforced());
+			if (AEInputCheckTriggered(AEVK_6))
+				benchmark_text = mem_tracker_dump_csv("./memory_stats.csv") ? "Memory counters written to memory_stats.csv" : "Could not write memory_stats.csv";
+#endif
 			AEInputGetCursorPosition(&mouse_x, &mouse_y);
 			if (AESysDoesWindowExist() == false)
 				gAEGameStateNext = AE_GS_QUIT;
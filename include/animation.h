@@ -37,17 +37,17 @@ private:
 	AEVec2 starting_offset; 
 	f32 interval; // How long between each frame
 	f32 frame_timer;
-	Sprite* sprite;
+	Render_State* sprite; // render state of the sprite the frames are played on
 	std::vector<AEVec2> offsets;
 public:
 	Animation() : curr_frame{ 0 }, frames{ 1 }, frame_length{ 0 }, starting_offset{ 0,0 }, interval{ 0 }, frame_timer{ 0 }, sprite{ nullptr }{}
 	Animation(u8 no_frames, AEVec2 offset, 
-		Sprite* sprite, s32 frame_len, f32 interval = G_DELTATIME);
-	Animation(Sprite* sprite, AEVec2* offsets, s32 offset_arr_size, f32 interval = G_DELTATIME);
+		Render_State* sprite, s32 frame_len, f32 interval = G_DELTATIME);
+	Animation(Render_State* sprite, AEVec2* offsets, s32 offset_arr_size, f32 interval = G_DELTATIME);
 	Animation(const Animation&);
 	~Animation();
 	void reverse_anims();
-	void set_sprite(Sprite*);
+	void set_sprite(Render_State*);
 	void play_animation(bool loop = true, f32 speed = 1.0f);
 	void play_anim_frame(u8 frame_no);
 	void set_offset(AEVec2);
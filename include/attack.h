@@ -14,7 +14,9 @@ The functions include:
 - unload functions for sword, spear and shield attacks
 - push_object
 - get_attack_collider
+- release_attack_collider
 - remove_attack_collider
+- get_attack_collider_stats
 - 8 sword attack functions
 - 9 spear attack functions
 - load functions for boss 1, 2 and 3 attacks
@@ -83,9 +85,12 @@ class Attack_Collider : public gameObject
 {
 public:
 	Attack_Collider(AEVec2 pos, Sprite* sprite, u32 layer,
-		AEVec2 scale, GO_TYPE type, bool is_static);
+		AEVec2 scale, GO_TYPE type, bool is_static, u32 transform = NO_TRANSFORM);
 	void set_aabb() override;
 public:
+	// The crates of boss 1 become GO_DESTRUCTABLE, which is shared with plain game objects
+	static constexpr u32 TYPE_MASK = go_type_bit(GO_TYPE::GO_PLAYERATTACKCOLLIDER) | go_type_bit(GO_TYPE::GO_ENEMYATTACKCOLLIDER) |
+		go_type_bit(GO_TYPE::GO_BOSSATTACKCOLLIDER) | go_type_bit(GO_TYPE::GO_PROJECTILE);
 	gameObject* owner;
 	s32 damage;
 	AEVec2 flinch_scale;
@@ -95,6 +100,17 @@ class Shield : public Attack_Collider
 {
 };
 
+// Attack colliders available to push_object before it falls back to the heap
+constexpr u32 ATTACK_COLLIDER_CAPACITY = 64;
+
+struct Attack_Collider_Stats
+{
+	u32 capacity;	// colliders in the pool
+	u32 in_use;		// colliders taken from the pool and not yet released
+	u32 peak;		// most colliders in use at once since the pool was created
+	u32 overflow;	// colliders allocated on the heap because the pool was empty
+};
+
 void sword_load();
 void spear_load();
 void shield_load();
@@ -110,7 +126,9 @@ void attacks_unload();
 
 gameObject* push_object(GO_TYPE type, gameObject* owner);
 Attack_Collider* get_attack_collider(gameObject* owner);
+void release_attack_collider(Attack_Collider* collider);
 void remove_attack_collider(gameObject* owner);
+Attack_Collider_Stats get_attack_collider_stats();
 
 void sword_attack_1(gameObject&);
 void sword_attack_2(gameObject&);
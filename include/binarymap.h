@@ -12,6 +12,7 @@ position in a level.
 
 The functions include:
 - load_platforms
+- is_free_platform
 
 Copyright (C) 2021 DigiPen Institure of Technology.
 Reproduction or disclosure of this file or its contents
@@ -36,6 +37,7 @@ class BinaryMap
 	int** MapData;
 	int map_width;
 	int map_height;
+	bool is_free_platform(const vector<bool>& merged, int x, int y) const;
 public:
 	BinaryMap() = delete;
 	BinaryMap(const char*);
@@ -65,6 +65,7 @@ public:
 	virtual void take_damage(s32);
 
 public:
+	static constexpr u32 TYPE_MASK = go_type_bit(GO_TYPE::GO_BOSS);
 	s32 full_health;
 	s32 health;
 	s32 attack_phase;
@@ -0,0 +1,69 @@
+/*!*************************************************************************
+****
+\file   broadphase.h
+\author agent
+\par    email: agent\@local
+\date   Oct 17 2026
+
+\brief
+This header file outlines an implementation of the broadphase of the
+collision system in the game engine. The broadphase buckets the bounding
+boxes of the game objects into a uniform grid so that only objects sharing a
+cell are handed to the narrowphase. A sweep along x and the all-pairs loop
+can be selected instead at runtime.
+
+The functions include:
+- get_sweep
+- get_swept_aabb
+- broadphase_set_static
+- broadphase_clear
+- broadphase_find_pairs
+- broadphase_find_terrain
+- set_broadphase_mode
+- get_broadphase_mode
+- get_collision_stats
+
+Copyright (C) 2026 DigiPen Institure of Technology.
+Reproduction or disclosure of this file or its contents
+without the prior written consent of DigiPen Institute of
+Technology is prohibited.
+****************************************************************************
+***/
+#pragma once
+#include "gameobject.h"
+
+// Width and height of a broadphase cell in world units
+constexpr f32 BROADPHASE_CELL_SIZE = 256.0f;
+
+// Objects spanning more cells than this are tested against every object
+constexpr u32 BROADPHASE_MAX_CELLS = 64;
+
+enum class BROADPHASE_MODE
+{
+	GRID,
+	SWEEP_AND_PRUNE,
+	BRUTE_FORCE,
+	TOTAL
+};
+
+struct Collision_Stats
+{
+	BROADPHASE_MODE mode;	// method used to find the pairs
+	u32 objects;			// active moving objects submitted to the broadphase
+	u32 static_objects;		// objects in the static grid
+	u32 brute_force_pairs;	// pairs the all-pairs loop would have tested
+	u32 pairs_tested;		// pairs handed to rtr_collide
+	u32 pairs_hit;			// pairs that collided
+	u32 allocations;		// heap allocations during the update, see collision_update
+	f64 time;				// seconds spent in collision_update
+};
+
+bool get_sweep(const gameObject& obj, AEVec2& displacement);
+AABB get_swept_aabb(const gameObject& obj);
+void broadphase_set_static(const vector<gameObject*>& v_static_objects);
+void broadphase_clear();
+void broadphase_find_pairs(const vector<gameObject*>& v_obj, vector<u64>& pairs);
+void broadphase_find_terrain(const vector<gameObject*>& v_obj, const AABB& aabb, vector<u32>& indices);
+void set_broadphase_mode(BROADPHASE_MODE broadphase_mode);
+BROADPHASE_MODE get_broadphase_mode();
+Collision_Stats& get_collision_stats();
@@ -25,6 +25,7 @@ The functions include:
 - get_camera_matrix
 - get_camera_target
 - get_camera_scale
+- get_view
 - shake
 - temp_zoom
 - look_at
@@ -74,6 +75,7 @@ public:
 	AEVec2 get_curr_pos();
 	AEVec2 get_camera_target();
 	AEVec2 get_camera_scale(void);
+	AABB get_view(f32 margin = 0.0f);
 	void shake();
 	void temp_zoom();
 	void look_at();
@@ -5,37 +5,60 @@
 \date   March 12 2021
 
 \brief
-This file outlines the implementation of all functions related Heart game
-objects as outlined in collectables.h
+This file outlines the implementation of all functions related to collectable
+game objects, such as the hearts dropped by enemies, as outlined in
+collectables.cpp
 
 The functions include:
-- Heart::Heart (default constructor)
-- heart_load
-- Heart::game_object_initialize
-- Heart::game_object_update
-- heart_unload
-- adjust_heart_movement
-- collectables_collide
-- spawn_heart
+- Collectable::Collectable (default and type constructor)
+- collectables_load
+- collectables_unload
+- spawn_collectable
+- release_collectable
+- collectable_pick_up
+- spawn_drop
+- get_collectable_stats
 
 Copyright (C) 2021 DigiPen Institure of Technology.
 Reproduction or disclosure of this file or its contents
 without the prior written consent of DigiPen Institute of
 Technology is prohibited.
 *******************************************************************************/
+#pragma once
 #include "gameobject.h"
 #include "audio.h"
 
-class Heart : public gameObject
+// Most collectables alive at once. Drops past this replace the oldest one.
+constexpr u32 COLLECTABLE_CAPACITY = 16;
+
+enum class COLLECTABLE_TYPE
+{
+	HEART,
+	TOTAL
+};
+
+class Collectable : public gameObject
 {
 public:
-	Heart();
-	void game_object_initialize() override;
+	static constexpr u32 TYPE_MASK = go_type_bit(GO_TYPE::GO_COLLECTABLES);
+	explicit Collectable(u32 transform = NO_TRANSFORM);
+	Collectable(COLLECTABLE_TYPE collectable_type, AEVec2 pos);
 	void game_object_update() override;
-	static Audio* pick_up_sound;
+	COLLECTABLE_TYPE collectable_type;
+};
+
+struct Collectable_Stats
+{
+	u32 capacity;	// collectables in the pool
+	u32 in_use;		// collectables spawned and not yet picked up
+	u32 peak;		// most collectables alive at once since the pool was created
+	u32 reused;		// drops that replaced the oldest collectable because the pool was full
 };
 
-void heart_load();
-void heart_unload();
-void collectables_collide(gameObject& obj);
-void spawn_heart(gameObject& enemy);
\ No newline at end of file
+void collectables_load();
+void collectables_unload();
+Collectable* spawn_collectable(COLLECTABLE_TYPE collectable_type, AEVec2 pos);
+void release_collectable(Collectable* collectable);
+void collectable_pick_up(Collectable& collectable);
+void spawn_drop(gameObject& enemy);
+Collectable_Stats get_collectable_stats();
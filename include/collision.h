@@ -11,6 +11,10 @@ game engine.
 
 The functions include:
 - rtr_collide
+- rtr_contact
+- rtr_sweep
+- rtr_collide_batch
+- collision_benchmark
 
 Copyright (C) 2021 DigiPen Institure of Technology.
 Reproduction or disclosure of this file or its contents
@@ -19,6 +23,7 @@ Technology is prohibited.
 ****************************************************************************
 ***/
 #pragma once
+#include <vector>
 #include "AEEngine.h"
 
 struct AABB
@@ -28,4 +33,44 @@ struct AABB
 };
 
 bool rtr_collide(const AABB& aabb1, const AEVec2& vel1,
-	const AABB& aabb2, const AEVec2& vel2);
\ No newline at end of file
+	const AABB& aabb2, const AEVec2& vel2);
+
+// How one object touches another, seen from the first object
+struct Contact
+{
+	f32 time;		// fraction of the frame at which the objects met, 0 if already overlapping
+	AEVec2 normal;	// axis of least penetration, pointing away from the other object
+	AEVec2 offset;	// centre of this bounding box minus the centre of the other
+	AEVec2 depth;	// penetration along each axis
+};
+
+Contact rtr_contact(const AABB& aabb1, const AABB& aabb2, f32 time = 0.0f);
+bool rtr_sweep(const AABB& aabb1, const AEVec2& disp1,
+	const AABB& aabb2, const AEVec2& disp2, f32& time, u32& axis);
+
+// Bounding boxes stored as separate arrays so that they can be tested 4 at a time
+struct AABB_Batch
+{
+	std::vector<f32> min_x;
+	std::vector<f32> min_y;
+	std::vector<f32> max_x;
+	std::vector<f32> max_y;
+	void clear();
+	void push_back(const AABB& aabb);
+	u32 size() const;
+};
+
+void rtr_collide_batch(const AABB& aabb, const AABB_Batch& batch, std::vector<u32>& hits);
+
+#if defined(DEBUG) | defined(_DEBUG)
+struct Collision_Benchmark
+{
+	u32 boxes;
+	u32 iterations;
+	f64 scalar_time;	// seconds spent in rtr_collide
+	f64 batch_time;		// seconds spent in rtr_collide_batch
+	bool results_match;
+};
+
+Collision_Benchmark collision_benchmark(u32 boxes, u32 iterations);
+#endif
@@ -0,0 +1,36 @@
+/*!*************************************************************************
+****
+\file   contact.h
+\author agent
+\par    email: agent\@local
+\date   Oct 17 2026
+
+\brief
+This header file outlines an implementation of the contact cache of the
+collision system in the game engine. The contact cache remembers which
+attacks have already hit a game object, so an attack touching a target for
+several frames only hits it once.
+
+The functions include:
+- contact_first_hit
+- contact_next_generation
+- get_contact_generation
+- contact_forget
+- contact_clear
+- get_contact_allocations
+
+Copyright (C) 2026 DigiPen Institure of Technology.
+Reproduction or disclosure of this file or its contents
+without the prior written consent of DigiPen Institute of
+Technology is prohibited.
+****************************************************************************
+***/
+#pragma once
+#include "gameobject.h"
+
+bool contact_first_hit(const gameObject& target, const gameObject& source, u32 generation = 0);
+void contact_next_generation();
+u32 get_contact_generation();
+void contact_forget(const gameObject& obj);
+void contact_clear();
+u32 get_contact_allocations();
@@ -64,6 +64,7 @@ private:
 	void start_invul();
 	void invul();
 public:
+	static constexpr u32 TYPE_MASK = go_type_bit(GO_TYPE::GO_MONSTER);
 	f32 cooldown_timer;
 	s32 full_health;
 	s32 health;
@@ -78,11 +79,13 @@ public:
 	ENEMY_TYPE enemy_type;
 	ENEMY_ANIM anim_state;
 	Effect debuff;
+	const Sprite_Asset* sprite_asset; // shared by every enemy loaded with the same sprite
+	Render_State render_state; // how the sprite of this enemy is drawn
 	
 	Enemy();
 	Enemy(s32 health);
 	Enemy(const Enemy&);
-	Enemy(s32 health, AEVec2 init_pos, AEVec2 scale, Sprite* spr);
+	Enemy(s32 health, AEVec2 init_pos, AEVec2 scale, const Sprite_Asset* asset);
 	Enemy& operator=(Enemy const&);
 	~Enemy();
 
@@ -96,7 +99,6 @@ public:
 	virtual void game_object_initialize() override;
 	virtual void game_object_update() override;
 	virtual void game_object_draw() override;
-	virtual void game_object_free() override;
 	virtual void game_object_unload() override;
 };
 
@@ -105,7 +107,7 @@ class RangedEnemy : public Enemy
 	f32 range;
 public:
 	RangedEnemy();
-	RangedEnemy(s32 health, AEVec2 init_pos, AEVec2 scale, Sprite* spr, f32 range = 1.0f);
+	RangedEnemy(s32 health, AEVec2 init_pos, AEVec2 scale, const Sprite_Asset* asset, f32 range = 1.0f);
 	void set_aabb() override;
 	void behaviour(gameObject& gameObj) override;
 
@@ -117,14 +119,14 @@ class MeleeEnemy1 : public Enemy
 {
 public:
 	MeleeEnemy1();
-	MeleeEnemy1(s32 health, AEVec2 init_pos, AEVec2 scale, Sprite* sprite);
+	MeleeEnemy1(s32 health, AEVec2 init_pos, AEVec2 scale, const Sprite_Asset* asset);
 };
 
 class MeleeEnemy2 : public Enemy
 {
 public:
 	MeleeEnemy2();
-	MeleeEnemy2(s32 health, AEVec2 init_pos, AEVec2 scale, Sprite* sprite);
+	MeleeEnemy2(s32 health, AEVec2 init_pos, AEVec2 scale, const Sprite_Asset* asset);
 	void behaviour(gameObject& gameObj) override;
 
 	virtual void game_object_load() override;
@@ -8,6 +8,10 @@
 \brief
 This header file outlines an enumeration classes required in the game.
 
+The functions include:
+- go_type_bit
+- go_types_interact
+
 Copyright (C) 2021 DigiPen Institure of Technology.
 Reproduction or disclosure of this file or its contents
 without the prior written consent of DigiPen Institute of
@@ -33,9 +37,100 @@ enum class GO_TYPE {
 	GO_TRAPS,
 	GO_PARTICLE,
 	GO_PARTICLESYSTEM,
-	GO_ATTACKINDICATOR
+	GO_ATTACKINDICATOR,
+	GO_TOTAL
+};
+
+/*!****************************************************************************
+ * @brief Gets the bit of a game object type in a collision mask
+ *
+ * @param type
+ * Type of the game object
+ * @return constexpr unsigned int
+ * Bit of the type
+******************************************************************************/
+constexpr unsigned int go_type_bit(GO_TYPE type)
+{
+	return 1u << static_cast<unsigned int>(type);
+}
+
+// Types whose collisions are read by the on_collide function of each type,
+// or by resolve_bodies for the types it resolves.
+// Keep this in sync with the on_collide functions, any pair where neither
+// side is interested is never tested by collision_update.
+constexpr unsigned int GO_COLLISION_MASK[static_cast<unsigned int>(GO_TYPE::GO_TOTAL)]
+{
+	// GO_PLAYER: player_collide
+	go_type_bit(GO_TYPE::GO_PLATFORM) | go_type_bit(GO_TYPE::GO_WALL) | go_type_bit(GO_TYPE::GO_DESTRUCTABLE) |
+	go_type_bit(GO_TYPE::GO_MONSTER) | go_type_bit(GO_TYPE::GO_COLLECTABLES) | go_type_bit(GO_TYPE::GO_TRAPS) |
+	go_type_bit(GO_TYPE::GO_ENEMYATTACKCOLLIDER) | go_type_bit(GO_TYPE::GO_BOSSATTACKCOLLIDER),
+	// GO_MONSTER: enemy_collide
+	go_type_bit(GO_TYPE::GO_PLATFORM) | go_type_bit(GO_TYPE::GO_WALL) | go_type_bit(GO_TYPE::GO_PLAYER) |
+	go_type_bit(GO_TYPE::GO_TRAPS) | go_type_bit(GO_TYPE::GO_PLAYERATTACKCOLLIDER),
+	// GO_BOSS: boss_collide clears on_ground whenever it runs, so it sees everything
+	~0u,
+	// GO_UI
+	0u,
+	// GO_PLATFORM
+	0u,
+	// GO_WALL
+	0u,
+	// GO_DESTRUCTABLE: plats_oncollide, crate_collide once the crate lands
+	go_type_bit(GO_TYPE::GO_PLATFORM) | go_type_bit(GO_TYPE::GO_ENEMYATTACKCOLLIDER) | go_type_bit(GO_TYPE::GO_BOSSATTACKCOLLIDER),
+	// GO_COLLECTABLES: resolve_bodies
+	go_type_bit(GO_TYPE::GO_PLATFORM),
+	// GO_PROJECTILE
+	0u,
+	// GO_PLAYERATTACKCOLLIDER: sword_collide, spear_collide, spear_attack_collide, shield_collide
+	go_type_bit(GO_TYPE::GO_MONSTER) | go_type_bit(GO_TYPE::GO_BOSS) |
+	go_type_bit(GO_TYPE::GO_ENEMYATTACKCOLLIDER) | go_type_bit(GO_TYPE::GO_BOSSATTACKCOLLIDER),
+	// GO_ENEMYATTACKCOLLIDER: fireball_oncollide, roots_oncollide
+	go_type_bit(GO_TYPE::GO_PLATFORM) | go_type_bit(GO_TYPE::GO_DESTRUCTABLE),
+	// GO_BOSSATTACKCOLLIDER: crate_collide, big_sword_collide, stab_collide
+	go_type_bit(GO_TYPE::GO_PLATFORM) | go_type_bit(GO_TYPE::GO_WALL) | go_type_bit(GO_TYPE::GO_PLAYER) |
+	go_type_bit(GO_TYPE::GO_BOSSATTACKCOLLIDER),
+	// GO_BOSS_SPAWNER: spawner_collide
+	go_type_bit(GO_TYPE::GO_PLAYER),
+	// GO_TRAPS: traps_collide
+	go_type_bit(GO_TYPE::GO_PLATFORM) | go_type_bit(GO_TYPE::GO_PLAYER),
+	// GO_PARTICLE
+	0u,
+	// GO_PARTICLESYSTEM
+	0u,
+	// GO_ATTACKINDICATOR
+	0u
 };
 
+/*!****************************************************************************
+ * @brief Checks if a collision between two types is read by either side
+ *
+ * @param lhs
+ * Type of the first game object
+ * @param rhs
+ * Type of the second game object
+ * @return true
+ * The pair has to be tested
+ * @return false
+ * Neither on_collide function cares about the pair
+******************************************************************************/
+constexpr bool go_types_interact(GO_TYPE lhs, GO_TYPE rhs)
+{
+	return (GO_COLLISION_MASK[static_cast<unsigned int>(lhs)] & go_type_bit(rhs)) ||
+		(GO_COLLISION_MASK[static_cast<unsigned int>(rhs)] & go_type_bit(lhs));
+}
+
+static_assert(static_cast<unsigned int>(GO_TYPE::GO_TOTAL) <= 32, "GO_TYPE does not fit in a collision mask");
+static_assert(go_types_interact(GO_TYPE::GO_PLATFORM, GO_TYPE::GO_PLAYER), "Collision mask is out of order");
+static_assert(!go_types_interact(GO_TYPE::GO_PARTICLESYSTEM, GO_TYPE::GO_PLATFORM), "Collision mask is out of order");
+
+// Types that fall asleep away from the camera. The player, bosses, attacks
+// and particles always stay awake since they are either near the camera or
+// have to finish on their own.
+constexpr unsigned int GO_SLEEP_MASK =
+	go_type_bit(GO_TYPE::GO_MONSTER) | go_type_bit(GO_TYPE::GO_PLATFORM) | go_type_bit(GO_TYPE::GO_WALL) |
+	go_type_bit(GO_TYPE::GO_DESTRUCTABLE) | go_type_bit(GO_TYPE::GO_COLLECTABLES) | go_type_bit(GO_TYPE::GO_BOSS_SPAWNER) |
+	go_type_bit(GO_TYPE::GO_TRAPS);
+
 enum class STATUS_TYPE
 {
 	BLEED
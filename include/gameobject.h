@@ -11,6 +11,7 @@ engine
 
 The functions include:
 - swap
+- reset
 - set_aabb
 - Draw_Obj
 - game_object_load
@@ -20,6 +21,11 @@ The functions include:
 - game_object_unload
 - collision_update
 - cmp_layer
+- get_handle
+- get_object
+- destroy_object
+- compact_objects
+- go_cast
 
 Copyright (C) 2021 DigiPen Institure of Technology.
 Reproduction or disclosure of this file or its contents
@@ -32,6 +38,8 @@ Technology is prohibited.
 #include "animation.h"
 #include "collision.h"
 #include "game_enums.h"
+#include "small_vector.h"
+#include "transform_store.h"
 
 using namespace std;
 class gameObject;
@@ -41,10 +49,35 @@ using fp = void (*)(gameObject&);
 
 constexpr u32 LAYER_PLATFORM = 2;
 
+// Colliders and contacts kept inside each game object before its lists move
+// to the heap. Most objects touch no more than a few others in a frame.
+constexpr u32 GO_INLINE_COLLIDERS = 4;
+using Collider_List = Small_Vector<gameObject*, GO_INLINE_COLLIDERS>;
+using Contact_List = Small_Vector<Contact, GO_INLINE_COLLIDERS>;
+
+// Refers to a game object without keeping it alive. Once the object is
+// destroyed or reassigned, get_object returns nullptr for the handle.
+struct Object_Handle
+{
+	u32 index;		// slot in the handle table
+	u32 generation;	// bumped every time the slot is released
+};
+
+constexpr u32 NO_HANDLE = ~0u;
+constexpr Object_Handle NULL_HANDLE{ NO_HANDLE, 0 };
+constexpr u32 NO_COLLIDER = ~0u;
+
 class gameObject
 {
 private:
+	// Transform of an object without a slot in the transform store
+	AEVec2 own_pos;
+	AEVec2 own_vel;
+	AEVec2 own_acc;
+	AABB own_box;
 	void swap(gameObject& rhs);
+protected:
+	explicit gameObject(u32 transform);
 public:
 	gameObject(); //ctor
 	gameObject(AEVec2 pos,
@@ -52,20 +85,22 @@ public:
 		u32 layer,
 		AEVec2 scale,
 		GO_TYPE type,
-		bool is_static);
+		bool is_static,
+		u32 transform = NO_TRANSFORM);
 	gameObject(const gameObject&);
 	gameObject& operator=(const gameObject&);
-	~gameObject() = default; //dtor
+	virtual ~gameObject(); //dtor
+	void reset();
 	bool flag;
-	AEVec2 curr_pos;
+	AEVec2& curr_pos; // refers into the transform store if the object has a slot
 	AEVec2 init_pos;
-	AABB bounding_box;
+	AABB& bounding_box;
 	vector<Animation> animations;
-	vector<gameObject*> colliders; // a list of gameobject that is colliding with this gameobject
-	vector<gameObject*> ignorecolliders; // a list of colliding game objects to ignore
+	Collider_List colliders; // a list of gameobject that is colliding with this gameobject
+	Contact_List contacts; // how each of the colliders touches this gameobject
 	AEVec2 scale;
-	AEVec2 curr_vel;
-	AEVec2 acceleration;
+	AEVec2& curr_vel;
+	AEVec2& acceleration;
 	fp on_collide;
 	Sprite* obj_sprite;
 	u32 layer; // rendering of graphics
@@ -74,6 +109,14 @@ public:
 	bool is_colliding;
 	bool is_static;
 	bool on_ground;
+	bool is_asleep; // skips update, collision and drawing while away from the camera
+	f32 wake_timer; // kept awake away from the camera until it runs out, see wake_object
+	bool is_dead; // set by destroy_object, deleted by compact_objects at the end of the frame
+	u32 id; // unique to each game object, used by the contact cache
+	u32 handle; // slot in the handle table, NO_HANDLE until get_handle is called
+	u32 attack_colliders; // pool slot of its newest attack collider, NO_COLLIDER if none
+	const u32 transform; // slot in the transform store, NO_TRANSFORM if the transform is its own
+	static constexpr u32 TYPE_MASK = ~0u; // types this class can be tagged with, see go_cast
 	void Draw_Obj();
 	virtual void set_aabb();
 	virtual void game_object_load();
@@ -85,4 +128,31 @@ public:
 };
 
 void collision_update(vector<gameObject*>& v_obj);
-bool cmp_layer(gameObject* const& lhs, gameObject* const& rhs);
\ No newline at end of file
+bool cmp_layer(gameObject* const& lhs, gameObject* const& rhs);
+Object_Handle get_handle(gameObject* obj);
+gameObject* get_object(Object_Handle handle);
+void wake_object(gameObject* obj);
+void destroy_object(gameObject* obj);
+void compact_objects(vector<gameObject*>& v_obj);
+/*!****************************************************************************
+ * @brief Downcasts a game object using its type instead of RTTI. T must
+ * declare TYPE_MASK, the types only objects of T are tagged with.
+ * Debug builds check the result against dynamic_cast.
+ *
+ * @tparam T
+ * Class to cast to
+ * @param obj
+ * Game object to cast, may be null
+ * @return T*
+ * obj as a T, or nullptr if its type is not in T::TYPE_MASK
+******************************************************************************/
+template <typename T>
+T* go_cast(gameObject* obj)
+{
+	if (!obj || !(go_type_bit(obj->type) & T::TYPE_MASK))
+		return nullptr;
+#if defined(DEBUG) | defined(_DEBUG)
+	AE_ASSERT_MESG(dynamic_cast<T*>(obj), "go_cast on a game object of the wrong class, check TYPE_MASK!");
+#endif
+	return static_cast<T*>(obj);
+}
@@ -39,18 +39,32 @@ struct Color {
 	f32 a;
 };
 
-class Sprite {
+// What a sprite is drawn with, shared by every instance of the sprite and
+// never changed through a const Sprite_Asset*
+struct Sprite_Asset
+{
+	AEGfxTexture* texture{ nullptr };
+	AEGfxVertexList* mesh{ nullptr };
+	AEVec2 size{ 1.0f, 1.0f }; // texture size
+	AEVec2 scale{ 1.0f, 1.0f };
+};
+
+// How one instance of a sprite is drawn
+struct Render_State
+{
+	AEVec2 offset{ 0.0f, 0.0f }; // texture offset
+	Color tint{ 1.0f, 1.0f, 1.0f, 1.0f };
+	f32 transparency{ 1.0f };
+	float rot{ 0.0f };
+	bool flip_x{ false };
+	bool flip_y{ false };
+};
+
+// A sprite with an asset of its own, for sprites whose texture or mesh is
+// changed while playing. Sprites that many objects draw the same way should
+// be shared as a Sprite_Asset, with a Render_State in each object.
+class Sprite : public Sprite_Asset, public Render_State {
 public:
-	AEGfxTexture* texture;
-	AEGfxVertexList* mesh;
-	AEVec2 offset; // texture offset
-	Color tint;
-	f32 transparency;
-	AEVec2 size; // texture size
-	AEVec2 scale;
-	float rot;
-	bool flip_x;
-	bool flip_y;
 	Sprite(); // ctor
 	Sprite(AEGfxTexture* tex,
 		AEGfxVertexList* mesh);
@@ -71,8 +85,7 @@ void draw(AEGfxTexture* texture,
 	AEVec2 scale = { 1.0f, 1.0f },
 	f32 rot = 0);
 
-//TODO - Implement this
-//void draw(const Sprite* sprite, AEVec2 position, AEVec2 scale = { 1,1 });
+void draw(const Sprite_Asset& asset, const Render_State& state, AEVec2 position, AEVec2 scale);
 
 void draw(const Sprite* sprite, AEVec2 position, AEVec2 scale = { 1, 1 });
 
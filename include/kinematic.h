@@ -0,0 +1,41 @@
+/*!*************************************************************************
+****
+\file   kinematic.h
+\author agent
+\par    email: agent\@local
+\date   Oct 17 2026
+
+\brief
+This header file outlines an implementation of the kinematic body resolver of
+the collision system in the game engine. The resolver pushes the player,
+enemies, bosses and hearts out of the platforms and walls they collide with,
+using only their position, velocity and scale along with a table of
+parameters for each type.
+
+The functions include:
+- get_body_params
+- resolve_body
+- resolve_bodies
+
+Copyright (C) 2026 DigiPen Institure of Technology.
+Reproduction or disclosure of this file or its contents
+without the prior written consent of DigiPen Institute of
+Technology is prohibited.
+****************************************************************************
+***/
+#pragma once
+#include "gameobject.h"
+
+struct Body_Params
+{
+	AEVec2 extent;		// half size of the resolved box as a fraction of scale
+	f32 step_height;	// deepest overlap the body is lifted onto a floor from
+	u32 floor_mask;		// types only landed on while falling
+	u32 solid_mask;		// types that also push the body out sideways
+	bool ceilings;		// whether solids push the body down when hit from below
+	bool drops;			// whether on_ground is cleared and found again every frame
+};
+
+const Body_Params* get_body_params(GO_TYPE type);
+void resolve_body(gameObject& obj, const Body_Params& params);
+void resolve_bodies(vector<gameObject*>& v_obj);
@@ -0,0 +1,81 @@
+/*!*************************************************************************
+****
+\file   level_arena.h
+\author agent
+\par    email: agent\@local
+\date   Oct 17 2026
+
+\brief
+This header file outlines an implementation of the level arena of the game
+engine. The game objects, sprites and containers that live as long as the
+level are created with level_arena_create where the level loads them, and
+are placed one after another in large blocks instead of being allocated one
+by one. Destroying them only runs their destructors, and the blocks are
+freed together when the level is unloaded.
+
+The functions include:
+- level_arena_release
+- level_arena_alloc
+- level_arena_create
+- level_arena_destroy
+- get_level_arena_stats
+
+Copyright (C) 2026 DigiPen Institure of Technology.
+Reproduction or disclosure of this file or its contents
+without the prior written consent of DigiPen Institute of
+Technology is prohibited.
+****************************************************************************
+***/
+#pragma once
+#include "AEEngine.h"
+#include <cstddef>
+#include <new>
+#include <utility>
+
+// Size of each block of the arena, larger allocations get a block of their own
+constexpr size_t LEVEL_ARENA_BLOCK_SIZE = 256 * 1024;
+
+struct Level_Arena_Stats
+{
+	u32 allocations;		// allocations placed in the arena by the current level
+	u32 blocks;				// blocks allocated for the current level
+	size_t bytes;			// bytes handed out, including alignment padding
+	size_t reserved;		// bytes of all the blocks
+};
+
+void level_arena_release();
+void* level_arena_alloc(size_t size, size_t align = alignof(std::max_align_t));
+const Level_Arena_Stats& get_level_arena_stats();
+
+/*!****************************************************************************
+ * @brief Constructs an object in the level arena
+ *
+ * @tparam T
+ * Type of the object
+ * @param args
+ * Arguments of the constructor
+ * @return T*
+ * The new object, freed with level_arena_destroy
+******************************************************************************/
+template <typename T, typename... Args>
+T* level_arena_create(Args&&... args)
+{
+	return ::new (level_arena_alloc(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+}
+
+/*!****************************************************************************
+ * @brief Destroys an object made by level_arena_create. Its memory is freed
+ * with the rest of the arena by level_arena_release.
+ *
+ * @tparam T
+ * Type of the object
+ * @param obj
+ * The object, may be null
+******************************************************************************/
+template <typename T>
+void level_arena_destroy(T* obj)
+{
+	if (!obj)
+		return;
+	obj->~T();
+}
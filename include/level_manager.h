@@ -64,9 +64,9 @@ public:
 	AABB area_cam;
 	static AABB boss_room_camera;
 	static vector<gameObject*> v_gameObjects;
-	static vector<Sprite*> v_sprites;
-	static vector<vector<Enemy*>*> v_area_enemies;
+	static vector<vector<Object_Handle>*> v_area_enemies; // enemies of each area, killed ones stop resolving
 	static vector<vector<gameObject*>*> v_area_walls;
+	static vector<gameObject*> v_static_objects;
 	s32 enemy_counter;
 	s32 current_area;
 	s32 level;
@@ -89,7 +89,7 @@ public:
 	bool load_traps(const rapidjson::Document& d);
 	bool load_boss(const rapidjson::Document& d);
 	bool load_camera_bounds(const rapidjson::Document& d);
-	void add_platform(AEVec2 const& pos);
+	void add_platform(AEVec2 const& pos, s32 columns = 1, s32 rows = 1);
 	void clear_area(s32 const);
 };
 
@@ -100,6 +100,14 @@ constexpr u32 MAX_AREA_WALLS = 20;
 constexpr s32 FILE_BUFFER = 65536;
 constexpr u32 MAX_AREA_ENEMY = 25;
 
+// Distance beyond the camera view within which sleeping objects wake up
+constexpr f32 ACTIVE_REGION_MARGIN = 256.0f;
+// Distance beyond the camera view past which objects fall asleep, larger so
+// that objects at the edge do not toggle every frame
+constexpr f32 SLEEP_REGION_MARGIN = 512.0f;
+// Seconds an object woken by a collision or an area stays awake away from the camera
+constexpr f32 WAKE_DURATION = 1.0f;
+
 void level_objects_update(std::vector<gameObject*>& v_obj);
 void objects_draw(std::vector<gameObject*>& v_obj);
 void spawner_collide(gameObject& obj);
\ No newline at end of file
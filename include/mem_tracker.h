@@ -0,0 +1,94 @@
+/*!*************************************************************************
+****
+\file   mem_tracker.h
+\author agent
+\par    email: agent\@local
+\date   Oct 17 2026
+
+\brief
+This header file outlines an implementation of the memory tracker of the
+game engine. Builds with MEM_TRACKING defined (the debug configuration)
+replace the global operator new and delete, and count every allocation
+under the tag of the subsystem that made it. A subsystem tags its
+allocations by opening a Mem_Scope, and the innermost scope wins, so a
+particle system created by an attack is counted as particles.
+
+For each tag the tracker keeps the live and peak bytes, and how many
+allocations were made in the last frame. A budget of allocations per frame
+can be set for each tag, which asserts when it is exceeded while budgets
+are enforced. Without MEM_TRACKING every function here does nothing.
+
+Memory that does not go through operator new, such as the blocks of the
+level arena and the memory of FMOD, is not counted.
+
+The functions include:
+- mem_tag_push
+- mem_tag_pop
+- mem_tracker_frame_start
+- mem_tracker_frame_end
+- mem_tracker_set_budget
+- mem_tracker_enforce_budgets
+- mem_tracker_budgets_enforced
+- mem_tracker_dump_csv
+- get_mem_tag_stats
+- get_mem_allocation_count
+- get_mem_tag_name
+
+Copyright (C) 2026 DigiPen Institure of Technology.
+Reproduction or disclosure of this file or its contents
+without the prior written consent of DigiPen Institute of
+Technology is prohibited.
+****************************************************************************
+***/
+#pragma once
+#include "AEEngine.h"
+
+enum class MEM_TAG
+{
+	OTHER,		// gameplay and anything not in a scope
+	LEVEL_LOAD,
+	PARTICLES,
+	ATTACKS,
+	AUDIO,
+	UI,
+	TOTAL
+};
+
+struct Mem_Tag_Stats
+{
+	size_t live_bytes;		// bytes allocated and not yet freed
+	size_t peak_bytes;		// most live bytes since the game started
+	u32 live_allocations;	// allocations not yet freed
+	u32 total_allocations;	// allocations since the game started
+	u32 frame_allocations;	// allocations made in the last frame
+	u32 budget;				// most allocations allowed in a frame, 0 for no budget
+};
+
+#ifdef MEM_TRACKING
+void mem_tag_push(MEM_TAG tag);
+void mem_tag_pop();
+void mem_tracker_frame_start();
+void mem_tracker_frame_end();
+#else
+inline void mem_tag_push(MEM_TAG) {}
+inline void mem_tag_pop() {}
+inline void mem_tracker_frame_start() {}
+inline void mem_tracker_frame_end() {}
+#endif
+void mem_tracker_set_budget(MEM_TAG tag, u32 allocations_per_frame);
+void mem_tracker_enforce_budgets(bool enforce);
+bool mem_tracker_budgets_enforced();
+bool mem_tracker_dump_csv(const char* path);
+const Mem_Tag_Stats& get_mem_tag_stats(MEM_TAG tag);
+u32 get_mem_allocation_count();
+const char* get_mem_tag_name(MEM_TAG tag);
+
+// Tags the allocations made until the end of the scope
+class Mem_Scope
+{
+public:
+	explicit Mem_Scope(MEM_TAG tag) { mem_tag_push(tag); }
+	~Mem_Scope() { mem_tag_pop(); }
+	Mem_Scope(const Mem_Scope&) = delete;
+	Mem_Scope& operator=(const Mem_Scope&) = delete;
+};
@@ -1,4 +1,4 @@
-/*!*****************************************************************************
+﻿/*!*****************************************************************************
 \file   particlesystem.h
 \author Mohammad Hanif Koh Teck Wee
 \par    DP email: mohammadhanifkoh.t\@digipen.edu
@@ -6,21 +6,37 @@
 
 \brief
 This file outlines the implementation of the particle system, and its data
-structure. It also contains the declaration of functions to create commonly used
-particle systems and all behaviour functions for particles.
+structure. Particle systems are never deleted while a level is running. A
+particle system that is done goes into a free list, and is reset in place
+the next time an effect is created, keeping its sprite and particle memory.
+It also contains the declaration of functions to create commonly used
+particle systems and all behaviours of particles.
 
 The functions include:
-- Particle constructors
+- Particle_Pool::Particle_Pool
+- Particle_Pool::reserve
+- Particle_Pool::clear
+- Particle_Pool::remove
+- particleSystem::reset
+- update_particles
+- update_particles_scalar
+- clear_particles
 - particle_system_load
 - particle_system_unload
+- get_particle_stats
+- set_particle_budget
+- particle_benchmark
 - create_particlesystem
-- damage_taken
-- particle_default_behaviour
-- boss_vulnerable
 - create_falling_particles
 - create_dash_particles
 - create_damaged_particles
 - create_ground_particles
+
+The behaviours of particles are kernels, which are values rather than
+functions. The kernels include:
+- damage_taken
+- particle_default_behaviour
+- boss_vulnerable
 - dodge_particle
 - slam_particle
 - spear_charge_particle
@@ -37,29 +53,100 @@ Technology is prohibited.
 #pragma once
 #include "gameobject.h"
 
-class particleSystem;
-class Particle : public gameObject
+// Behaviour of the particles of a particle system. Every particle of the
+// system is changed the same way each frame, so the particles are updated 4 at
+// a time instead of calling a function for each of them.
+struct Particle_Kernel
+{
+	f32 fade;				// alpha lost every frame
+	f32 fade_rate;			// alpha lost every second
+	AEVec2 grow;			// scale gained every frame
+	AEVec2 grow_rate;		// scale gained every second
+	f32 random_grow_x;		// most scale x gained every second, picked at random for each particle
+	f32 gravity;			// downward speed gained every second
+	bool follow;			// particles are moved to the particle system before moving
+	bool seek;				// particles turn towards the particle system, keeping their speed
+};
+
+// How important the particles of a particle system are. When many particles
+// are alive, the less important particle systems emit fewer particles first.
+enum class PARTICLE_PRIORITY
+{
+	AMBIENT,	// decoration, such as falling debris and crumbling walls
+	EFFECT,		// feedback of attacks, hits and movement
+	ESSENTIAL,	// tells the player something, such as a telegraphed attack
+	TOTAL
+};
+
+// Most particles alive at once across every particle system
+constexpr u32 PARTICLE_BUDGET = 1000;
+
+// Values kept for each particle, each stored in an array of its own
+enum class PARTICLE_FIELD
+{
+	POS_X, POS_Y,
+	VEL_X, VEL_Y,
+	ORIGIN_X, ORIGIN_Y,	// position the particle was emitted at
+	SCALE_X, SCALE_Y,
+	ROT,
+	LIFETIME,
+	RED, GREEN, BLUE, ALPHA,
+	TOTAL
+};
+
+// Particles of a particle system. The array of each value is laid out one
+// after another in a single block, which is only allocated when the capacity
+// grows, so emitting a particle never allocates. Alive particles are kept at
+// the start of the arrays, a dead particle is replaced by the last one.
+class Particle_Pool
 {
 public:
-	void game_object_update() override;
+	Particle_Pool();
+	void reserve(u32 new_capacity);
+	void clear();
+	void remove(u32 index);
 
-	particleSystem* parent;
-	AEVec2 initial_position;
-	f32 lifetime;
-	f32 max_distance;
-	fp behaviour;
+	f32* field(PARTICLE_FIELD value) { return memory.data() + static_cast<u32>(value) * capacity; }
+	const f32* field(PARTICLE_FIELD value) const { return memory.data() + static_cast<u32>(value) * capacity; }
+	f32* pos_x() { return field(PARTICLE_FIELD::POS_X); }
+	f32* pos_y() { return field(PARTICLE_FIELD::POS_Y); }
+	f32* vel_x() { return field(PARTICLE_FIELD::VEL_X); }
+	f32* vel_y() { return field(PARTICLE_FIELD::VEL_Y); }
+	f32* origin_x() { return field(PARTICLE_FIELD::ORIGIN_X); }
+	f32* origin_y() { return field(PARTICLE_FIELD::ORIGIN_Y); }
+	f32* scale_x() { return field(PARTICLE_FIELD::SCALE_X); }
+	f32* scale_y() { return field(PARTICLE_FIELD::SCALE_Y); }
+	f32* rot() { return field(PARTICLE_FIELD::ROT); }
+	f32* lifetime() { return field(PARTICLE_FIELD::LIFETIME); }
+	f32* red() { return field(PARTICLE_FIELD::RED); }
+	f32* green() { return field(PARTICLE_FIELD::GREEN); }
+	f32* blue() { return field(PARTICLE_FIELD::BLUE); }
+	f32* alpha() { return field(PARTICLE_FIELD::ALPHA); }
+
+	u32 capacity;	// particles the block has room for
+	u32 count;		// particles alive
+private:
+	vector<f32> memory;
 };
 
 class particleSystem : public gameObject
 {
 public:
+	static constexpr u32 TYPE_MASK = go_type_bit(GO_TYPE::GO_PARTICLESYSTEM);
 	particleSystem(AEVec2 position, AEVec2 size, bool loop, u32 max_particles, f32 lifetime, f32 emission_rate,
-		f32 max_distance, fp behaviour, Color color_range[2], f32 lifetime_range[2],
+		f32 max_distance, const Particle_Kernel& kernel, Color color_range[2], f32 lifetime_range[2],
 		AEVec2 scale_range[2], f32 rotation_range[2], f32 direction_range[2],
 		f32 speed_range[2], AEGfxTexture* texture);
 
 	particleSystem(gameObject* target, AEVec2 size, bool loop, u32 max_particles, f32 lifetime, f32 emission_rate,
-		f32 max_distance, fp behaviour, Color color_range[2], f32 lifetime_range[2],
+		f32 max_distance, const Particle_Kernel& kernel, Color color_range[2], f32 lifetime_range[2],
+		AEVec2 scale_range[2], f32 rotation_range[2], f32 direction_range[2],
+		f32 speed_range[2], AEGfxTexture* texture);
+	~particleSystem() override;
+	particleSystem(const particleSystem&) = delete;
+	particleSystem& operator=(const particleSystem&) = delete;
+	void reset(AEVec2 position, gameObject* target, AEVec2 size, bool loop, u32 max_particles, f32 lifetime,
+		f32 emission_rate, f32 max_distance, const Particle_Kernel& kernel, Color color_range[2], f32 lifetime_range[2],
 		AEVec2 scale_range[2], f32 rotation_range[2], f32 direction_range[2],
 		f32 speed_range[2], AEGfxTexture* texture);
 	void game_object_update() override;
@@ -68,27 +155,62 @@ public:
 	void delete_system();
 
 	bool loop;
-	gameObject* target;
+	Object_Handle target; // followed game object, stops following once it is destroyed
 	AEVec2 position_offset;
 	u32 max_particles;
-	u32 particle_count;
 	u32 particle_increment;
 	f32 lifetime;
 	f32 timer;
 	f32 emission_rate;
 	f32 max_distance;
-	fp behaviour;
-	vector<Particle> particles;
+	Particle_Kernel kernel;
+	PARTICLE_PRIORITY priority;
+	f32 emission_carry; // part of a particle owed by emissions scaled down by the budget
+	Particle_Pool particles; // drawn with the sprite of the particle system
 	Color color_range[2];
 	f32 lifetime_range[2];
 	AEVec2 scale_range[2];
 	f32 rotation_range[2];
 	f32 direction_range[2];
 	f32 speed_range[2];
+	particleSystem* next_free; // next particle system in the free list, while this one is in it
+};
+
+struct Particle_Stats
+{
+	u32 alive;		// particles alive in every particle system
+	u32 peak;		// most particles alive at once since the level loaded
+	u32 emitted;	// particles emitted since the level loaded
+	u32 updated;	// particles updated in the last frame
+	u32 budget;		// most particles alive at once
+	u32 throttled;	// particles not emitted because of the budget since the level loaded
+	u32 systems;	// particle systems allocated since the level loaded
+	u32 reused;		// particle systems taken from the free list since the level loaded
+};
+
+#if defined(DEBUG) | defined(_DEBUG)
+struct Particle_Benchmark
+{
+	u32 particles;
+	u32 iterations;
+	f64 scalar_time;	// seconds spent in update_particles_scalar
+	f64 batch_time;		// seconds spent in update_particles
+	bool results_match;
 };
+#endif
 
+void update_particles(Particle_Pool& particles, const Particle_Kernel& kernel, AEVec2 center, f32 max_distance,
+	f32 dt, vector<u32>& dead);
+void update_particles_scalar(Particle_Pool& particles, const Particle_Kernel& kernel, AEVec2 center, f32 max_distance,
+	f32 dt, vector<u32>& dead);
+void clear_particles(particleSystem& pSystem);
 void particle_system_load();
 void particle_system_unload();
+const Particle_Stats& get_particle_stats();
+void set_particle_budget(u32 budget);
+#if defined(DEBUG) | defined(_DEBUG)
+Particle_Benchmark particle_benchmark(u32 count, u32 iterations);
+#endif
 
 particleSystem* create_particlesystem(gameObject* target);
 particleSystem* create_particlesystem(AEVec2 target);
@@ -98,13 +220,13 @@ particleSystem* create_dash_particles(gameObject* target);
 particleSystem* create_damaged_particles(gameObject* target);
 particleSystem* create_ground_particles(gameObject* target);
 
-void boss_vulnerable(gameObject& obj);
-void particle_default_behaviour(gameObject& obj);
-void damage_taken(gameObject& obj);
-void dodge_particle(gameObject& obj);
-void slam_particle(gameObject& obj);
-void spear_charge_particle(gameObject& obj);
-void spear_throw_particle(gameObject& obj);
-void parry_particle(gameObject& obj);
-void shockwave_particle(gameObject& obj);
-void change_wep_particle(gameObject& obj);
\ No newline at end of file
+extern const Particle_Kernel boss_vulnerable;
+extern const Particle_Kernel particle_default_behaviour;
+extern const Particle_Kernel damage_taken;
+extern const Particle_Kernel dodge_particle;
+extern const Particle_Kernel slam_particle;
+extern const Particle_Kernel spear_charge_particle;
+extern const Particle_Kernel spear_throw_particle;
+extern const Particle_Kernel parry_particle;
+extern const Particle_Kernel shockwave_particle;
+extern const Particle_Kernel change_wep_particle;
\ No newline at end of file
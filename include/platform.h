@@ -0,0 +1,34 @@
+/*!*************************************************************************
+****
+\file   platform.h
+\author agent
+\par    email: agent\@local
+\date   Oct 17 2026
+
+\brief
+This header file outlines an implementation of the platforms of a level.
+Adjacent platform tiles of the binary map are merged into a single platform
+game object, which collides as one box and draws each of its tiles.
+
+The functions include:
+- Platform::Platform
+- Platform::game_object_draw
+
+Copyright (C) 2026 DigiPen Institure of Technology.
+Reproduction or disclosure of this file or its contents
+without the prior written consent of DigiPen Institute of
+Technology is prohibited.
+****************************************************************************
+***/
+#pragma once
+#include "gameobject.h"
+
+class Platform : public gameObject
+{
+public:
+	Platform(AEVec2 pos, Sprite* sprite, AEVec2 tile_scale, s32 columns, s32 rows);
+	void game_object_draw() override;
+	AEVec2 tile_scale;
+	s32 columns;
+	s32 rows;
+};
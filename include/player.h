@@ -59,6 +59,7 @@ private:
 	void swap(Player& rhs); // mat
 
 public:
+	static constexpr u32 TYPE_MASK = go_type_bit(GO_TYPE::GO_PLAYER);
 	u8 sword_upgrade;
 	u8 spear_upgrade;
 	s32 health;
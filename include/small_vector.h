@@ -0,0 +1,259 @@
+/*!*************************************************************************
+****
+\file   small_vector.h
+\author agent
+\par    email: agent\@local
+\date   Oct 17 2026
+
+\brief
+This header file outlines an implementation of a small vector for the game
+engine. The first N elements are stored inside the small vector itself, and
+only a list that grows past them allocates memory on the heap. Clearing the
+list keeps its memory, so a list that is filled and cleared every frame
+stops allocating once it has grown to the size it needs.
+
+Only trivially copyable elements are supported, which covers the pointers
+and contacts kept by the collision system.
+
+The functions include:
+- get_small_vector_stats
+- Small_Vector::Small_Vector (default, copy and move constructors)
+- Small_Vector::operator=
+- Small_Vector::~Small_Vector
+- Small_Vector::push_back
+- Small_Vector::clear
+- Small_Vector::reserve
+- Small_Vector::grow
+- Small_Vector::release
+- Small_Vector::take
+
+Copyright (C) 2026 DigiPen Institure of Technology.
+Reproduction or disclosure of this file or its contents
+without the prior written consent of DigiPen Institute of
+Technology is prohibited.
+****************************************************************************
+***/
+#pragma once
+#include "AEEngine.h"
+#include <cstring>
+#include <new>
+#include <type_traits>
+
+struct Small_Vector_Stats
+{
+	u32 allocations;	// heap allocations made by small vectors since the game started
+	u32 frees;			// heap allocations freed by small vectors
+	size_t bytes;		// bytes currently allocated on the heap by small vectors
+};
+
+/*!****************************************************************************
+ * @brief Gets the heap allocation counters shared by every small vector
+ *
+ * @return Small_Vector_Stats&
+ * Allocation counters
+******************************************************************************/
+inline Small_Vector_Stats& get_small_vector_stats()
+{
+	static Small_Vector_Stats stats{};
+	return stats;
+}
+
+template <typename T, u32 N>
+class Small_Vector
+{
+	static_assert(std::is_trivially_copyable<T>::value, "Small_Vector only holds trivially copyable elements!");
+	static_assert(N > 0, "Small_Vector needs at least one inline element!");
+public:
+	typedef T* iterator;
+	typedef const T* const_iterator;
+
+	Small_Vector() : first{ inline_data() }, count{ 0 }, capacity{ N } {}
+
+	/*!****************************************************************************
+	 * @brief Copies the elements of another small vector
+	 *
+	 * @param rhs
+	 * Small vector to copy
+	******************************************************************************/
+	Small_Vector(const Small_Vector& rhs) : Small_Vector()
+	{
+		reserve(rhs.count);
+		std::memcpy(first, rhs.first, rhs.count * sizeof(T));
+		count = rhs.count;
+	}
+
+	/*!****************************************************************************
+	 * @brief Takes the elements of another small vector, along with its heap
+	 * memory if it has any
+	 *
+	 * @param rhs
+	 * Small vector to move from, left empty
+	******************************************************************************/
+	Small_Vector(Small_Vector&& rhs) noexcept : Small_Vector()
+	{
+		take(rhs);
+	}
+
+	/*!****************************************************************************
+	 * @brief Copy assignment
+	 *
+	 * @param rhs
+	 * Small vector to copy
+	 * @return Small_Vector&
+	 * This small vector
+	******************************************************************************/
+	Small_Vector& operator=(const Small_Vector& rhs)
+	{
+		if (this != &rhs)
+		{
+			count = 0;
+			reserve(rhs.count);
+			std::memcpy(first, rhs.first, rhs.count * sizeof(T));
+			count = rhs.count;
+		}
+		return *this;
+	}
+
+	/*!****************************************************************************
+	 * @brief Move assignment
+	 *
+	 * @param rhs
+	 * Small vector to move from, left empty
+	 * @return Small_Vector&
+	 * This small vector
+	******************************************************************************/
+	Small_Vector& operator=(Small_Vector&& rhs) noexcept
+	{
+		if (this != &rhs)
+		{
+			release();
+			take(rhs);
+		}
+		return *this;
+	}
+
+	~Small_Vector()
+	{
+		release();
+	}
+
+	/*!****************************************************************************
+	 * @brief Adds an element to the back, moving to the heap if the inline
+	 * elements or the heap memory are full
+	 *
+	 * @param value
+	 * Element to add
+	******************************************************************************/
+	void push_back(const T& value)
+	{
+		if (count == capacity)
+		{
+			T copy = value; // value may be in the memory being replaced
+			grow(capacity * 2);
+			first[count++] = copy;
+			return;
+		}
+		first[count++] = value;
+	}
+
+	/*!****************************************************************************
+	 * @brief Removes every element. Heap memory is kept for the next time the
+	 * list is filled.
+	******************************************************************************/
+	void clear()
+	{
+		count = 0;
+	}
+
+	/*!****************************************************************************
+	 * @brief Makes room for a number of elements
+	 *
+	 * @param size
+	 * Number of elements to make room for
+	******************************************************************************/
+	void reserve(u32 size)
+	{
+		if (size > capacity)
+			grow(size);
+	}
+
+	iterator begin() { return first; }
+	iterator end() { return first + count; }
+	const_iterator begin() const { return first; }
+	const_iterator end() const { return first + count; }
+	T& operator[](u32 index) { return first[index]; }
+	const T& operator[](u32 index) const { return first[index]; }
+	T* data() { return first; }
+	const T* data() const { return first; }
+	u32 size() const { return count; }
+	bool empty() const { return count == 0; }
+	bool is_inline() const { return first == inline_data(); }
+
+private:
+	alignas(T) unsigned char storage[N * sizeof(T)];
+	T* first;
+	u32 count;
+	u32 capacity;
+
+	T* inline_data() { return reinterpret_cast<T*>(storage); }
+	const T* inline_data() const { return reinterpret_cast<const T*>(storage); }
+
+	/*!****************************************************************************
+	 * @brief Moves the elements to heap memory with a larger capacity
+	 *
+	 * @param size
+	 * New capacity, larger than the current one
+	******************************************************************************/
+	void grow(u32 size)
+	{
+		T* memory = static_cast<T*>(::operator new(size * sizeof(T)));
+		std::memcpy(memory, first, count * sizeof(T));
+		release();
+		Small_Vector_Stats& stats = get_small_vector_stats();
+		++stats.allocations;
+		stats.bytes += size * sizeof(T);
+		first = memory;
+		capacity = size;
+	}
+
+	/*!****************************************************************************
+	 * @brief Frees the heap memory, if any, and goes back to the inline
+	 * elements. The elements are not kept.
+	******************************************************************************/
+	void release()
+	{
+		if (!is_inline())
+		{
+			Small_Vector_Stats& stats = get_small_vector_stats();
+			++stats.frees;
+			stats.bytes -= capacity * sizeof(T);
+			::operator delete(first);
+		}
+		first = inline_data();
+		capacity = N;
+	}
+
+	/*!****************************************************************************
+	 * @brief Takes the elements of another small vector. This small vector
+	 * must not have heap memory.
+	 *
+	 * @param rhs
+	 * Small vector to take from, left empty
+	******************************************************************************/
+	void take(Small_Vector& rhs)
+	{
+		if (rhs.is_inline())
+		{
+			std::memcpy(first, rhs.first, rhs.count * sizeof(T));
+		}
+		else
+		{
+			first = rhs.first;
+			capacity = rhs.capacity;
+			rhs.first = rhs.inline_data();
+			rhs.capacity = N;
+		}
+		count = rhs.count;
+		rhs.count = 0;
+	}
+};
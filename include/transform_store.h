@@ -0,0 +1,55 @@
+/*!*************************************************************************
+****
+\file   transform_store.h
+\author agent
+\par    email: agent\@local
+\date   Oct 17 2026
+
+\brief
+This header file outlines an implementation of the transform store of the
+game engine. The store owns the positions, velocities, accelerations and
+bounding boxes of the pooled attack colliders and collectables, kept in
+fixed arrays indexed by slot. Each pooled object claims a slot when its
+pool is created, and its curr_pos, curr_vel, acceleration and bounding_box
+refer into the arrays, so the behaviour and collision code read and write
+the store directly.
+
+level_objects_update prepares every awake object with a slot after its
+game_object_update, and the store then integrates all of them and finds
+their bounds in a single loop over the arrays. Objects without a slot keep
+their transform inside the game object and move themselves.
+
+The functions include:
+- transform_store_claim
+- transform_store_release
+- transform_store_pos
+- transform_store_vel
+- transform_store_acc
+- transform_store_box
+- transform_store_prepare
+- transform_store_integrate
+
+Copyright (C) 2026 DigiPen Institure of Technology.
+Reproduction or disclosure of this file or its contents
+without the prior written consent of DigiPen Institute of
+Technology is prohibited.
+****************************************************************************
+***/
+#pragma once
+#include "collision.h"
+
+class gameObject;
+
+constexpr u32 NO_TRANSFORM = ~0u;
+// Slots in the store, enough for the attack collider and collectable pools.
+// Objects created while the store is full keep their own transform.
+constexpr u32 TRANSFORM_STORE_CAPACITY = 128;
+
+u32 transform_store_claim();
+void transform_store_release(u32 slot);
+AEVec2& transform_store_pos(u32 slot);
+AEVec2& transform_store_vel(u32 slot);
+AEVec2& transform_store_acc(u32 slot);
+AABB& transform_store_box(u32 slot);
+bool transform_store_prepare(gameObject& obj);
+void transform_store_integrate(f32 dt);
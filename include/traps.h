@@ -13,6 +13,7 @@
 	- game_object_initialize
 	- game_object_update
 	- game_object_draw
+	- traps_get_asset
 	- traps_load
 	- traps_free
 	- traps_unload
@@ -40,10 +41,13 @@ enum class TRAPS_TYPE {
 class Traps : public gameObject {
 private:
 public:
+	static constexpr u32 TYPE_MASK = go_type_bit(GO_TYPE::GO_TRAPS);
 	s32 damage;
 	TRAPS_TYPE traps_type;
+	const Sprite_Asset* sprite_asset; // shared by every trap of the type, nullptr for killzones
+	Render_State render_state;
 	Traps();
-	Traps(AEVec2 init_pos, AEVec2 scale, TRAPS_TYPE traps_type, Sprite* spr);
+	Traps(AEVec2 init_pos, AEVec2 scale, TRAPS_TYPE traps_type);
 	~Traps();
 
 	void set_aabb();
@@ -56,14 +60,14 @@ class SpikeTraps : public Traps
 {
 public:
 	SpikeTraps();
-	SpikeTraps(AEVec2 init_pos, AEVec2 scale, TRAPS_TYPE traps_type, Sprite* spr);
+	SpikeTraps(AEVec2 init_pos, AEVec2 scale, TRAPS_TYPE traps_type);
 };
 
 class LavaTraps : public Traps
 {
 public:
 	LavaTraps();
-	LavaTraps(AEVec2 init_pos, AEVec2 scale, TRAPS_TYPE traps_type, Sprite* spr);
+	LavaTraps(AEVec2 init_pos, AEVec2 scale, TRAPS_TYPE traps_type);
 };
 class IciclesTraps : public Traps
 {
@@ -72,9 +76,10 @@ public:
 	void set_aabb() override;
 public:
 	IciclesTraps();
-	IciclesTraps(AEVec2 init_pos, AEVec2 scale, TRAPS_TYPE traps_type, Sprite* spr);
+	IciclesTraps(AEVec2 init_pos, AEVec2 scale, TRAPS_TYPE traps_type);
 };
 
+const Sprite_Asset* traps_get_asset(TRAPS_TYPE traps_type);
 void traps_load();
 void traps_free();
 void traps_unload();
@@ -34,14 +34,14 @@ Technology is prohibited.
  * @param offset
  * 	Offset position in the spritesheet
  * @param sprite
- * 	Sprite pointer representing the sprite
+ * 	Render state of the sprite the frames are played on
  * @param frame_len
  * 	Length of the frame per iteration, in pixels
  * @param interval
  * 	How long before the game will draw the next frame in the animation
  */
 Animation::Animation(u8 no_frames, AEVec2 offset,
-	Sprite* sprite, s32 frame_len, f32 interval) :
+	Render_State* sprite, s32 frame_len, f32 interval) :
 	curr_frame{}, frame_timer{}, starting_offset{ offset }, frame_length{ frame_len }
 {
 	frames = no_frames;
@@ -60,13 +60,13 @@ Animation::Animation(u8 no_frames, AEVec2 offset,
  * This constructor can be used to take in an array of offsets
  *
  * @param sprite
- * Sprite pointer representing the sprite
+ * Render state of the sprite the frames are played on
  * @param p_offsets
  * Pointer representing an array of offsets
  * @param size
  * Size of the array pointer
  */
-Animation::Animation(Sprite* sprite, AEVec2* p_offsets, s32 size, f32 interval) : Animation()
+Animation::Animation(Render_State* sprite, AEVec2* p_offsets, s32 size, f32 interval) : Animation()
 {
 	frames = (u8)size;
 	this->sprite = sprite;
@@ -113,7 +113,7 @@ Animation::~Animation()
  * @param new_sprite
  * New sprite to set
  */
-void Animation::set_sprite(Sprite* new_sprite)
+void Animation::set_sprite(Render_State* new_sprite)
 {
 	sprite = new_sprite;
 }
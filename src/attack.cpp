@@ -16,9 +16,12 @@ The functions include:
 - Player_Attack::operator==
 - attacks_load
 - attacks_init
+- get_collider_head
 - push_object
 - get_attack_collider
+- release_attack_collider
 - remove_attack_collider
+- get_attack_collider_stats
 - attacks_unload
 - Attack_Collider::set_aabb
 
@@ -34,10 +37,31 @@ Technology is prohibited.
 #include "boss.h"
 #include "traps.h"
 #include "level_manager.h"
+#include "contact.h"
+#include "mem_tracker.h"
 
 static AEGfxVertexList* pMesh_attackcollider;
 static Camera* level_cam;
 
+// Attack colliders live in v_gameObjects for the whole level and are only
+// switched on and off, so attacks never allocate or erase from the vector
+static vector<Sprite> v_pool_sprites;
+static vector<Attack_Collider> v_pool_colliders;
+static vector<bool> v_pool_used;
+// Free slots are reused in the order they were released, so a collider
+// released this frame is not handed out again while others may still hold it
+static vector<u32> v_pool_free;
+static u32 pool_free_head, pool_free_count;
+static Attack_Collider_Stats pool_stats;
+// The colliders of each owner form a list through the pool, newest first,
+// starting from the attack_colliders of the owner, so finding the collider of
+// an owner does not have to search the level
+static u32 ownerless_colliders;
+static vector<u32> v_pool_next;
+static vector<u32> v_pool_prev;
+// Colliders allocated on the heap while the pool was empty, which are searched for
+static u32 heap_colliders;
+
 /*!*****************************************************************************
   \brief
 	Constructor for the Attack class
@@ -167,10 +191,14 @@ Boss_Attack::Boss_Attack(f32 leeway_timer, u32 anim_index,
 
   \bool is_static
 	Whether the attack collider is static or not
+
+  \param transform
+	Slot in the transform store to keep the transform in, NO_TRANSFORM by
+	default
 *******************************************************************************/
 Attack_Collider::Attack_Collider(AEVec2 pos, Sprite* sprite, u32 layer,
-	AEVec2 scale, GO_TYPE type, bool is_static)
-	: gameObject{ pos, sprite, layer, scale, type, is_static },
+	AEVec2 scale, GO_TYPE type, bool is_static, u32 transform)
+	: gameObject{ pos, sprite, layer, scale, type, is_static, transform },
 	damage{ 0 }, owner{ nullptr }, flinch_scale{ 0.0f } {};
 
 /*!*****************************************************************************
@@ -198,6 +226,29 @@ void attacks_load()
 	shield_load();
 	pMesh_attackcollider = create_square_mesh(1.0f, 1.0f, 0xFFFFFFFF);
 	AE_ASSERT_MESG(pMesh_attackcollider, "Failed to create Attack Collider Mesh!!");
+
+	// Reserved up front so the colliders and their sprites never move. Each
+	// collider keeps its transform in the transform store for the whole level.
+	v_pool_sprites.reserve(ATTACK_COLLIDER_CAPACITY);
+	v_pool_colliders.reserve(ATTACK_COLLIDER_CAPACITY);
+	v_pool_used.assign(ATTACK_COLLIDER_CAPACITY, false);
+	v_pool_free.resize(ATTACK_COLLIDER_CAPACITY);
+	v_pool_next.assign(ATTACK_COLLIDER_CAPACITY, NO_COLLIDER);
+	v_pool_prev.assign(ATTACK_COLLIDER_CAPACITY, NO_COLLIDER);
+	ownerless_colliders = NO_COLLIDER;
+	heap_colliders = 0;
+	for (u32 i{ 0 }; i < ATTACK_COLLIDER_CAPACITY; ++i)
+	{
+		v_pool_sprites.emplace_back(nullptr, pMesh_attackcollider, AEVec2{ 75.0f, 75.0f });
+		v_pool_colliders.emplace_back(AEVec2{ -20.0f, 150.0f }, &v_pool_sprites[i], 9, AEVec2{ 75.0f, 75.0f },
+			GO_TYPE::GO_PLAYERATTACKCOLLIDER, false, transform_store_claim());
+		v_pool_colliders[i].flag = false;
+		(Level::v_gameObjects).push_back(&v_pool_colliders[i]);
+		v_pool_free[i] = i;
+	}
+	pool_free_head = 0;
+	pool_free_count = ATTACK_COLLIDER_CAPACITY;
+	pool_stats = { ATTACK_COLLIDER_CAPACITY, 0, 0, 0 };
 }
 
 /*!*****************************************************************************
@@ -212,10 +263,26 @@ void attacks_init(vector<Player_Attack>& v_sword_attacks, vector<Player_Attack>&
 	shield_init(v_sword_attacks);
 }
 
+/*!*****************************************************************************
+  \brief
+	Gets the first pool slot in the list of colliders of an owner.
+
+  \param owner
+	The owner of the colliders, nullptr for the colliders with no owner.
+
+  \return
+	A reference to the slot, NO_COLLIDER if the owner has no collider.
+*******************************************************************************/
+static u32& get_collider_head(gameObject* owner)
+{
+	return owner ? owner->attack_colliders : ownerless_colliders;
+}
+
 /*!*****************************************************************************
   \brief
 	Pushes an object into the vector of game objects, depending on the type
-	inputted by the user.
+	inputted by the user. Attack colliders are taken from the pool created in
+	attacks_load, which is already in the vector.
 
   \param type
 	The type of the object to push in
@@ -228,9 +295,39 @@ void attacks_init(vector<Player_Attack>& v_sword_attacks, vector<Player_Attack>&
 *******************************************************************************/
 gameObject* push_object(GO_TYPE type, gameObject* owner)
 {
-	if (type == GO_TYPE::GO_BOSSATTACKCOLLIDER || type == GO_TYPE::GO_PLAYERATTACKCOLLIDER ||
+	Mem_Scope mem_scope(MEM_TAG::ATTACKS);
+	if ((type == GO_TYPE::GO_BOSSATTACKCOLLIDER || type == GO_TYPE::GO_PLAYERATTACKCOLLIDER ||
+		type == GO_TYPE::GO_ENEMYATTACKCOLLIDER) && pool_free_count)
+	{
+		u32 index = v_pool_free[pool_free_head];
+		pool_free_head = (pool_free_head + 1) % ATTACK_COLLIDER_CAPACITY;
+		--pool_free_count;
+		v_pool_used[index] = true;
+		pool_stats.in_use++;
+		pool_stats.peak = AEMax(pool_stats.peak, pool_stats.in_use);
+
+		// Reset the collider as if it was newly created, which also gives it a new id
+		Sprite& attack_collider_spr = v_pool_sprites[index];
+		Attack_Collider& attack_collider = v_pool_colliders[index];
+		attack_collider_spr = Sprite(nullptr, pMesh_attackcollider, { 75.0f, 75.0f });
+		attack_collider = Attack_Collider({ -20.0f, 150.0f }, &attack_collider_spr, 9, { 75.0f,75.0f }, type, false);
+		attack_collider.owner = owner;
+
+		// Link it in front of the other colliders of the owner
+		u32& head = get_collider_head(owner);
+		v_pool_prev[index] = NO_COLLIDER;
+		v_pool_next[index] = head;
+		if (head != NO_COLLIDER)
+			v_pool_prev[head] = index;
+		head = index;
+		return &attack_collider;
+	}
+	else if (type == GO_TYPE::GO_BOSSATTACKCOLLIDER || type == GO_TYPE::GO_PLAYERATTACKCOLLIDER ||
 		type == GO_TYPE::GO_ENEMYATTACKCOLLIDER)
 	{
+		// The pool is empty, counted so that ATTACK_COLLIDER_CAPACITY can be raised
+		pool_stats.overflow++;
+		heap_colliders++;
 		Sprite* attack_collider_spr;
 		Attack_Collider* attack_collider;
 		attack_collider_spr = new Sprite(nullptr, pMesh_attackcollider, { 75.0f, 75.0f });
@@ -244,8 +341,7 @@ gameObject* push_object(GO_TYPE type, gameObject* owner)
 	else if (type == GO_TYPE::GO_TRAPS)
 	{
 		Traps* traps;
-		Sprite* traps_sprite = new Sprite(nullptr, pMesh_attackcollider, { 50.0f, 50.0f });
-		traps = new Traps({ -20.0f, 150.0f }, { 50.0f,50.0f }, TRAPS_TYPE::TRAPS_SPIKE, traps_sprite);
+		traps = new Traps({ -20.0f, 150.0f }, { 50.0f,50.0f }, TRAPS_TYPE::TRAPS_SPIKE);
 		traps->layer = 9;
 		traps->type = type;
 		traps->is_static = true;
@@ -267,8 +363,9 @@ gameObject* push_object(GO_TYPE type, gameObject* owner)
 
 /*!*****************************************************************************
   \brief
-	Searches for an existing attack collider from within the vector of game
-	objects. Returns nullptr if not found.
+	Finds the newest attack collider of an owner through the list of its
+	colliders in the pool. Returns nullptr if not found. The vector of game
+	objects is only searched while colliders from the heap are alive.
 
   \param owner
 	The gameobject that owns the attack collider to be searched for.
@@ -278,13 +375,23 @@ gameObject* push_object(GO_TYPE type, gameObject* owner)
 *******************************************************************************/
 Attack_Collider* get_attack_collider(gameObject* owner)
 {
+	for (u32 i = get_collider_head(owner); i != NO_COLLIDER; i = v_pool_next[i])
+	{
+		Attack_Collider& collider = v_pool_colliders[i];
+		if (collider.type == GO_TYPE::GO_PLAYERATTACKCOLLIDER ||
+			collider.type == GO_TYPE::GO_BOSSATTACKCOLLIDER ||
+			collider.type == GO_TYPE::GO_ENEMYATTACKCOLLIDER)
+			return &collider;
+	}
+	if (!heap_colliders)
+		return nullptr;
 	for (gameObject* i : Level::v_gameObjects)
 	{
-		if (i->type == GO_TYPE::GO_PLAYERATTACKCOLLIDER ||
+		if (!i->is_dead && (i->type == GO_TYPE::GO_PLAYERATTACKCOLLIDER ||
 			i->type == GO_TYPE::GO_BOSSATTACKCOLLIDER ||
-			i->type == GO_TYPE::GO_ENEMYATTACKCOLLIDER)
+			i->type == GO_TYPE::GO_ENEMYATTACKCOLLIDER))
 		{
-			Attack_Collider* collider = dynamic_cast<Attack_Collider*>(i);
+			Attack_Collider* collider = go_cast<Attack_Collider>(i);
 			if (collider->owner == owner) return collider;
 		}
 	}
@@ -293,23 +400,76 @@ Attack_Collider* get_attack_collider(gameObject* owner)
 
 /*!*****************************************************************************
   \brief
-	Removes an attack collider from the vector of game objects.
+	Switches off an attack collider and returns it to the pool. Colliders that
+	did not come from the pool are destroyed, and deleted by compact_objects at
+	the end of the frame.
+
+  \param collider
+	The attack collider to be released
+*******************************************************************************/
+void release_attack_collider(Attack_Collider* collider)
+{
+	// Its hits are kept by id, which the collider loses when it is reused
+	contact_forget(*collider);
+	if (!v_pool_colliders.empty() && collider >= &v_pool_colliders.front() && collider <= &v_pool_colliders.back())
+	{
+		u32 index = static_cast<u32>(collider - &v_pool_colliders.front());
+		collider->flag = false;
+		if (!v_pool_used[index])
+			return;
+		v_pool_used[index] = false;
+
+		// Unlink it from the colliders of its owner
+		if (v_pool_prev[index] != NO_COLLIDER)
+			v_pool_next[v_pool_prev[index]] = v_pool_next[index];
+		else
+			get_collider_head(collider->owner) = v_pool_next[index];
+		if (v_pool_next[index] != NO_COLLIDER)
+			v_pool_prev[v_pool_next[index]] = v_pool_prev[index];
+		v_pool_prev[index] = v_pool_next[index] = NO_COLLIDER;
+
+		v_pool_free[(pool_free_head + pool_free_count) % ATTACK_COLLIDER_CAPACITY] = index;
+		++pool_free_count;
+		pool_stats.in_use--;
+		return;
+	}
+	if (collider->is_dead)
+		return;
+	delete collider->obj_sprite;
+	collider->obj_sprite = nullptr;
+	destroy_object(collider);
+	if (heap_colliders)
+		heap_colliders--;
+}
+
+/*!*****************************************************************************
+  \brief
+	Removes the attack collider of an owner by releasing it.
 
   \param ower
 	The owner of the attack collider to be removed
 *******************************************************************************/
 void remove_attack_collider(gameObject* owner)
 {
-	if (gameObject* collider = get_attack_collider(owner))
+	if (Attack_Collider* collider = get_attack_collider(owner))
 	{
-		(Level::v_gameObjects).erase(std::remove((Level::v_gameObjects).begin(), (Level::v_gameObjects).end(),
-			collider), (Level::v_gameObjects).end());
-		delete collider->obj_sprite;
-		delete collider;
-		collider = nullptr;
+		release_attack_collider(collider);
 	}
 }
 
+/*!*****************************************************************************
+  \brief
+	Gets the usage of the attack collider pool
+
+  \return
+	The capacity, current and peak usage of the pool, and how many colliders
+	had to be allocated on the heap.
+*******************************************************************************/
+Attack_Collider_Stats get_attack_collider_stats()
+{
+	return pool_stats;
+}
+
 /*!*****************************************************************************
   \brief
 	Unloads all assets and deallocates memory used in attack functions. Calls
@@ -322,6 +482,23 @@ void attacks_unload()
 	sword_unload();
 	shield_unload();
 	AEGfxMeshFree(pMesh_attackcollider);
+
+	// The pool owns its colliders, so they are taken out before the level deletes the rest
+	if (!v_pool_colliders.empty())
+	{
+		const Attack_Collider* first = &v_pool_colliders.front();
+		const Attack_Collider* last = &v_pool_colliders.back();
+		(Level::v_gameObjects).erase(std::remove_if((Level::v_gameObjects).begin(), (Level::v_gameObjects).end(),
+			[first, last](const gameObject* obj) { return obj >= first && obj <= last; }), (Level::v_gameObjects).end());
+	}
+	v_pool_colliders.clear();
+	v_pool_sprites.clear();
+	v_pool_used.clear();
+	v_pool_free.clear();
+	v_pool_next.clear();
+	v_pool_prev.clear();
+	ownerless_colliders = NO_COLLIDER;
+	pool_free_count = 0;
 }
 
 /*!*****************************************************************************
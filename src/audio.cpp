@@ -31,6 +31,7 @@ Technology is prohibited.
 ***/
 #include "main.h"
 #include "audio.h"
+#include "mem_tracker.h"
 
 static constexpr f32 LERP_VOLUME_FACTOR = 0.1f;
 static void lerp_volume(std::pair<const AUDIO_GROUP, AudioGroup>& pair);
@@ -118,6 +119,7 @@ void AudioSystem::init()
  */
 void AudioSystem::update()
 {
+	Mem_Scope mem_scope(MEM_TAG::AUDIO);
 	result = system->update();
 	std::for_each(channel_group.begin(), channel_group.end(), lerp_volume);
 }
@@ -230,6 +232,7 @@ void AudioSystem::crossfade(AUDIO_GROUP lhs, AUDIO_GROUP rhs)
  */
 Audio::Audio(char const* path, AUDIO_GROUP group) : sound{}, volume{ 1 }, group{group}
 {
+	Mem_Scope mem_scope(MEM_TAG::AUDIO);
 	AudioSystem::instance()->result = AudioSystem::instance()->system->createSound(path, FMOD_DEFAULT, 0, &sound);
 }
 
@@ -275,6 +278,7 @@ string audio_group_ts(AUDIO_GROUP ag)
  */
 void Audio::play_sound(f32 volume, bool loop)
 {
+	Mem_Scope mem_scope(MEM_TAG::AUDIO);
 	FMOD::Channel* pChannel = nullptr;
 	if (!loop)
 		sound->setMode(FMOD_LOOP_OFF);
@@ -12,6 +12,7 @@ position in a level.
 
 The functions include:
 - load_platforms
+- is_free_platform
 
 Copyright (C) 2021 DigiPen Institure of Technology.
 Reproduction or disclosure of this file or its contents
@@ -83,27 +84,74 @@ BinaryMap::BinaryMap(const char* FileName) : MapData{ 0 }, map_width{ 0 }, map_h
  * position of the binary map have to be scaled by the level_scale of the 
  * level object
  * 
+ * Adjacent platform cells are merged into rectangles, so that each rectangle
+ * is added as a single platform. A rectangle is grown along a row first, then
+ * down the following rows for as long as the whole run is platform cells.
+ * 
  * @param level 
  * Pointer to the level
  */
 void BinaryMap::load_platforms(Level* level)
 {
 	AEVec2 pos;
-	for (int i{ 0 }; i < map_width; ++i)
+	vector<bool> merged(static_cast<size_t>(map_width) * map_height, false);
+	for (int j{ 0 }; j < map_height; ++j)
 	{
-		for (int j{ 0 }; j < map_height; ++j)
+		for (int i{ 0 }; i < map_width; ++i)
 		{
-			// Change pos to scale to game world
-			pos = { ((f32)i + 0.5f) * Level::level_scale.x,
-				((f32)j + 0.5f) * Level::level_scale.y };
-			if (MapData[j][i] == static_cast<int>(BINARY_OBJECT::TYPE_PLATFORM))
-			{
-				level->add_platform(pos);
-			}
 			if (MapData[j][i] == static_cast<int>(BINARY_OBJECT::TYPE_HERO))
 			{
+				// Change pos to scale to game world
+				pos = { ((f32)i + 0.5f) * Level::level_scale.x,
+					((f32)j + 0.5f) * Level::level_scale.y };
 				level->player->init_pos = pos;
 			}
+			if (!is_free_platform(merged, i, j))
+				continue;
+
+			int columns{ 1 };
+			while (i + columns < map_width && is_free_platform(merged, i + columns, j))
+				++columns;
+			int rows{ 1 };
+			while (j + rows < map_height)
+			{
+				int k{ 0 };
+				while (k < columns && is_free_platform(merged, i + k, j + rows))
+					++k;
+				if (k < columns)
+					break;
+				++rows;
+			}
+			for (int y{ j }; y < j + rows; ++y)
+			{
+				for (int x{ i }; x < i + columns; ++x)
+				{
+					merged[static_cast<size_t>(y) * map_width + x] = true;
+				}
+			}
+			pos = { ((f32)i + columns * 0.5f) * Level::level_scale.x,
+				((f32)j + rows * 0.5f) * Level::level_scale.y };
+			level->add_platform(pos, columns, rows);
 		}
 	}
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Checks if a cell is a platform that has not been merged yet
+ * 
+ * @param merged 
+ * Cells that are already part of a platform
+ * @param x 
+ * Column of the cell
+ * @param y 
+ * Row of the cell
+ * @return true 
+ * The cell is a platform that is not merged
+ * @return false 
+ * The cell is not a platform or is already merged
+ */
+bool BinaryMap::is_free_platform(const vector<bool>& merged, int x, int y) const
+{
+	return MapData[y][x] == static_cast<int>(BINARY_OBJECT::TYPE_PLATFORM) &&
+		!merged[static_cast<size_t>(y) * map_width + x];
+}
@@ -39,6 +39,8 @@ Technology is prohibited.
 #include "player_data.h"
 #include "graphics.h"
 #include "camera.h"
+#include "contact.h"
+#include "mem_tracker.h"
 
 constexpr u32 BOSS_LAYER = 3;
 static bool weakened = 0;
@@ -154,56 +156,6 @@ void unload_boss_assets()
 	weakened = false;
 }
 
-/*!*****************************************************************************
-  \brief
-	Function to handle collision between Boss objects and platforms
-
-  \param e_obj
-	a reference to a game object, assumed to be the boss game object itself.
-
-  \param obj
-	a reference to a game object, assumed to be the platform that the heart is
-	colliding with
-*******************************************************************************/
-void adjust_boss_movement(gameObject& e_obj, const gameObject& obj)
-{
-	Boss* boss = dynamic_cast<Boss*>(&e_obj);
-
-	f32 boss_hw = (boss->bounding_box.max.x - boss->bounding_box.min.x) / 2;
-	f32 boss_hh = (boss->bounding_box.max.y - boss->bounding_box.min.y) / 2;
-	f32 obj_halfscale_x = (obj.bounding_box.max.x - obj.bounding_box.min.x) / 2;
-	f32 obj_halfscale_y = (obj.bounding_box.max.y - obj.bounding_box.min.y) / 2;
-
-	AEVec2 boss_middle{ boss->bounding_box.min.x + boss_hw, boss->bounding_box.min.y + boss_hh };
-
-	AEVec2 diff_pos = { obj.bounding_box.min.x + obj_halfscale_x, obj.bounding_box.min.y + obj_halfscale_y };
-	AEVec2Sub(&diff_pos, &boss_middle, &diff_pos);
-
-	f32 min_distx = boss_hw + obj_halfscale_x;
-	f32 min_disty = boss_hh + obj_halfscale_y;
-
-	f32 depth_x = min_distx - fabs(diff_pos.x);
-
-	f32 depth_y = min_disty - fabs(diff_pos.y);
-	if (depth_x != 0 && depth_y != 0)
-	{
-		if (obj.type == GO_TYPE::GO_WALL && fabs(depth_x) < fabs(depth_y))
-		{
-			boss->curr_pos.x += diff_pos.x < 0 ? -depth_x : +depth_x;
-		}
-		else
-		{
-			boss->curr_pos.y += depth_y;
-			boss->curr_vel.y = 0;
-
-			if (diff_pos.y > 0)
-			{
-				boss->on_ground = true;
-			}
-		}
-	}
-}
-
 /*!*****************************************************************************
   \brief
 	Function to handle collision of boss with other game objects. Checks
@@ -215,42 +167,19 @@ void adjust_boss_movement(gameObject& e_obj, const gameObject& obj)
 *******************************************************************************/
 void boss_collide(gameObject& obj)
 {
-	Boss* boss = dynamic_cast<Boss*>(&obj);
-	boss->on_ground = false;
-	vector<gameObject*>& colliders = obj.colliders;
-	for (vector<gameObject*>::iterator i = colliders.begin(); i != colliders.end(); ++i)
+	Boss* boss = go_cast<Boss>(&obj);
+	Collider_List& colliders = obj.colliders;
+	for (Collider_List::iterator i = colliders.begin(); i != colliders.end(); ++i)
 	{
 		gameObject& obj_col = **i;
-		if (obj_col.type == GO_TYPE::GO_PLATFORM && !boss->on_ground)
-		{
-			AEVec2 e1{ 0,1 };
-			if (AEVec2DotProduct(&boss->curr_vel, &e1) < 0)
-			{
-				adjust_boss_movement(obj, obj_col);
-			}
-		}
-
-		if (obj_col.type == GO_TYPE::GO_WALL)
-		{
-			adjust_boss_movement(obj, obj_col);
-		}
-
 		if (obj_col.type == GO_TYPE::GO_PLAYERATTACKCOLLIDER)
 		{
 			if (!boss->is_invul)
 			{
-				bool ignore{ false };
-				for (gameObject* x : boss->ignorecolliders)
-				{
-					if (x == &obj_col)
-					{
-						ignore = true;
-						break;
-					}
-				}
-				if (ignore) continue;
+				// Each attack only hits once
+				if (!contact_first_hit(*boss, obj_col, get_contact_generation())) continue;
 
-				Attack_Collider* attack_collider = dynamic_cast<Attack_Collider*>(&obj_col);
+				Attack_Collider* attack_collider = go_cast<Attack_Collider>(&obj_col);
 				s32 dmg_taken = attack_collider->damage;
 				dmg_taken = boss->is_vul ? dmg_taken : dmg_taken / 2;
 				boss->take_damage(dmg_taken);
@@ -269,7 +198,6 @@ void boss_collide(gameObject& obj)
 					pParticleSystem->speed_range[0] = 300.0f;
 					pParticleSystem->speed_range[1] = 500.0f;
 				}
-				boss->ignorecolliders.push_back(attack_collider);
 			}
 		}
 	}
@@ -298,6 +226,7 @@ void Boss::attack()
 		{
 			if (!curr_Attack->attack)
 				return;
+			Mem_Scope mem_scope(MEM_TAG::ATTACKS);
 			curr_Attack->attack(*this);
 			attack_timer -= G_DELTATIME;
 		}
@@ -357,7 +286,7 @@ void Boss::start_vul(f32 timer)
 	pParticleSystem->lifetime_range[0] = pParticleSystem->lifetime_range[1] = 1.5f;
 	pParticleSystem->scale_range[0] = pParticleSystem->scale_range[1] = { 100.0f, 100.0f };
 	pParticleSystem->speed_range[0] = pParticleSystem->speed_range[1] = 0.0f;
-	pParticleSystem->behaviour = boss_vulnerable;
+	pParticleSystem->kernel = boss_vulnerable;
 	pParticleSystem->obj_sprite->texture = pTexVulnerable;
 }
 
@@ -436,7 +365,7 @@ void Boss::weak()
 			pParticleSystem->lifetime_range[0] = pParticleSystem->lifetime_range[1] = 1.5f;
 			pParticleSystem->scale_range[0] = pParticleSystem->scale_range[1] = { 100.0f, 100.0f };
 			pParticleSystem->speed_range[0] = pParticleSystem->speed_range[1] = 0.0f;
-			pParticleSystem->behaviour = boss_vulnerable;
+			pParticleSystem->kernel = boss_vulnerable;
 			pParticleSystem->obj_sprite->texture = pTexVulnerable2;
 		}
 		obj_sprite->tint = { 1.0f, 0.0f, 0.0f, 1.0f };
@@ -153,7 +153,7 @@ void boss_jump(gameObject& gameObj)
 	static f32 alpha_increment;
 	static particleSystem* pParticleSystem{ nullptr };
 
-	Boss* boss = dynamic_cast<Boss*> (&gameObj);
+	Boss* boss = go_cast<Boss>(&gameObj);
 	if (!boss) return;
 	if (!Level::player) return;
 	Attack_Collider* collider = get_attack_collider(boss);
@@ -161,7 +161,7 @@ void boss_jump(gameObject& gameObj)
 	if (!boss->setup)
 	{
 		num_crates = 0;
-		collider = dynamic_cast<Attack_Collider*>(push_object(GO_TYPE::GO_BOSSATTACKCOLLIDER, boss));
+		collider = go_cast<Attack_Collider>(push_object(GO_TYPE::GO_BOSSATTACKCOLLIDER, boss));
 		collider->obj_sprite->texture = pTex_cut;
 		collider->damage = jump.damage;
 		collider->flag = false;
@@ -237,7 +237,7 @@ void boss_jump(gameObject& gameObj)
 	{
 		if (num_crates < 3)
 		{
-			collider = dynamic_cast<Attack_Collider*>(push_object(GO_TYPE::GO_BOSSATTACKCOLLIDER, boss));
+			collider = go_cast<Attack_Collider>(push_object(GO_TYPE::GO_BOSSATTACKCOLLIDER, boss));
 			collider->damage = jump.damage;
 			collider->obj_sprite->texture = pTex_crate;
 			collider->obj_sprite->rot = PI / 4;
@@ -262,7 +262,7 @@ void boss_jump(gameObject& gameObj)
 			boss->is_facing_right = Level::player->curr_pos.x > boss->curr_pos.x;
 			boss->curr_vel.x = boss->is_facing_right ? 1000.0f : -1000.0f;
 			boss->attack_timer = 1.5f;
-			collider = dynamic_cast<Attack_Collider*>(push_object(GO_TYPE::GO_BOSSATTACKCOLLIDER, boss));
+			collider = go_cast<Attack_Collider>(push_object(GO_TYPE::GO_BOSSATTACKCOLLIDER, boss));
 			collider->damage = jump.damage;
 			collider->obj_sprite->texture = nullptr;
 			collider->obj_sprite->tint.a = 0.0f;
@@ -301,7 +301,7 @@ void boss_jump(gameObject& gameObj)
 				pParticleSystem->obj_sprite->flip_x = boss->is_facing_right;
 				pParticleSystem->scale = { 1, 1 };
 				pParticleSystem->max_particles = 4;
-				pParticleSystem->behaviour = nullptr;
+				pParticleSystem->kernel = {};
 				pParticleSystem->obj_sprite->texture = pTex_arrow;
 				pParticleSystem->color_range[0] = { 1.0f, 1.0f, 1.0f, 0.5f };
 				pParticleSystem->color_range[1] = { 1.0f, 1.0f, 1.0f, 0.5f };
@@ -363,9 +363,10 @@ void boss_jump(gameObject& gameObj)
 *******************************************************************************/
 void crate_collide(gameObject& obj)
 {
-	Attack_Collider* collider = dynamic_cast<Attack_Collider*>(&obj);
-	vector<gameObject*>& colliders = obj.colliders;
-	for (vector<gameObject*>::iterator i = colliders.begin(); i != colliders.end(); ++i)
+	// A landed crate is tagged GO_DESTRUCTABLE, which go_cast does not take
+	Attack_Collider* collider = static_cast<Attack_Collider*>(&obj);
+	Collider_List& colliders = obj.colliders;
+	for (Collider_List::iterator i = colliders.begin(); i != colliders.end(); ++i)
 	{
 		gameObject& obj_col = **i;
 		if (obj_col.type == GO_TYPE::GO_PLATFORM)
@@ -378,7 +379,7 @@ void crate_collide(gameObject& obj)
 
 		if (obj_col.type == GO_TYPE::GO_BOSSATTACKCOLLIDER)
 		{
-			collider->flag = false;
+			release_attack_collider(collider);
 		}
 	}
 }
@@ -396,7 +397,7 @@ void crate_collide(gameObject& obj)
 *******************************************************************************/
 void boss_boomerang(gameObject& gameObj)
 {
-	Boss* boss = dynamic_cast<Boss*> (&gameObj);
+	Boss* boss = go_cast<Boss>(&gameObj);
 	if (!boss) return;
 	if (!Level::player) return;
 	Attack_Collider* collider = get_attack_collider(boss);
@@ -404,7 +405,7 @@ void boss_boomerang(gameObject& gameObj)
 	if (!boss->setup)
 	{
 		boss->attack_phase = 1;
-		collider = dynamic_cast<Attack_Collider*>(push_object(GO_TYPE::GO_BOSSATTACKCOLLIDER, boss));
+		collider = go_cast<Attack_Collider>(push_object(GO_TYPE::GO_BOSSATTACKCOLLIDER, boss));
 		boss->is_facing_right = Level::player->curr_pos.x > boss->curr_pos.x;
 		collider->obj_sprite->texture = pTex_boomerang;
 		collider->damage = boomerang.damage;
@@ -443,7 +444,7 @@ void boss_slash(gameObject& gameObj)
 {
 	static particleSystem* pParticleSystem;
 	static f32 anim_time;
-	Boss* boss = dynamic_cast<Boss*> (&gameObj);
+	Boss* boss = go_cast<Boss>(&gameObj);
 	if (!boss) return;
 	if (!Level::player) return;
 	Attack_Collider* collider = get_attack_collider(boss);
@@ -453,7 +454,7 @@ void boss_slash(gameObject& gameObj)
 		anim_time = 0;
 		boss->attack_phase = 1;
 		boss->is_facing_right = Level::player->curr_pos.x > boss->curr_pos.x;
-		collider = dynamic_cast<Attack_Collider*>(push_object(GO_TYPE::GO_BOSSATTACKCOLLIDER, boss));
+		collider = go_cast<Attack_Collider>(push_object(GO_TYPE::GO_BOSSATTACKCOLLIDER, boss));
 		collider->flag = false;
 		collider->obj_sprite->texture = pTex_slash;
 		collider->damage = slash.damage;
@@ -521,7 +522,7 @@ void boss_slam(gameObject& gameObj)
 	static particleSystem* pParticleSystem;
 	static f32 anim_time;
 
-	Boss* boss = dynamic_cast<Boss*> (&gameObj);
+	Boss* boss = go_cast<Boss>(&gameObj);
 	if (!boss) return;
 	if (!Level::player) return;
 	Attack_Collider* collider = get_attack_collider(boss);
@@ -530,7 +531,7 @@ void boss_slam(gameObject& gameObj)
 	{
 		anim_time = 0;
 		boss->attack_phase = 1;
-		collider = dynamic_cast<Attack_Collider*>(push_object(GO_TYPE::GO_BOSSATTACKCOLLIDER, boss));
+		collider = go_cast<Attack_Collider>(push_object(GO_TYPE::GO_BOSSATTACKCOLLIDER, boss));
 		boss->is_facing_right = Level::player->curr_pos.x > boss->curr_pos.x;
 		collider->flag = false;
 		collider->obj_sprite->texture = pTex_slam;
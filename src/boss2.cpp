@@ -179,8 +179,7 @@ void  Boss2::game_object_initialize()
 
 	for (int i{ 0 }; i < 10; ++i)
 	{
-		atkcol_fireballs[i] = dynamic_cast<Attack_Collider*> (push_object(GO_TYPE::GO_ENEMYATTACKCOLLIDER, nullptr));
-		delete atkcol_fireballs[i]->obj_sprite;
+		atkcol_fireballs[i] = go_cast<Attack_Collider>(push_object(GO_TYPE::GO_ENEMYATTACKCOLLIDER, nullptr));
 		atkcol_fireballs[i]->obj_sprite = fireball_sprite;
 		atkcol_fireballs[i]->obj_sprite->texture = pTex_fireball;
 		atkcol_fireballs[i]->type = GO_TYPE::GO_ENEMYATTACKCOLLIDER;
@@ -194,8 +193,7 @@ void  Boss2::game_object_initialize()
 
 	for (int i{ 0 }; i < 2; ++i)
 	{
-		atkcol_roots[i] = dynamic_cast<Attack_Collider*> (push_object(GO_TYPE::GO_ENEMYATTACKCOLLIDER, nullptr));
-		delete atkcol_roots[i]->obj_sprite;
+		atkcol_roots[i] = go_cast<Attack_Collider>(push_object(GO_TYPE::GO_ENEMYATTACKCOLLIDER, nullptr));
 		atkcol_roots[i]->obj_sprite = roots_sprite;
 		atkcol_roots[i]->obj_sprite->texture = pTex_roots;
 		atkcol_roots[i]->type = GO_TYPE::GO_ENEMYATTACKCOLLIDER;
@@ -210,7 +208,7 @@ void  Boss2::game_object_initialize()
 
 	for (int i{ 0 }; i < 10; ++i)
 	{
-		lava_traps[i] = dynamic_cast<Traps*> (push_object(GO_TYPE::GO_TRAPS, nullptr));
+		lava_traps[i] = go_cast<Traps>(push_object(GO_TYPE::GO_TRAPS, nullptr));
 		lava_traps[i]->type = GO_TYPE::GO_TRAPS;
 		lava_traps[i]->traps_type = TRAPS_TYPE::TRAPS_FIRE;
 		lava_traps[i]->scale = { 50.0f, 50.0f };
@@ -311,8 +309,8 @@ void  Boss2::set_attack()
 *******************************************************************************/
 void plats_oncollide(gameObject& plats)
 {
-	vector<gameObject*>& colliders = plats.colliders;
-	for (vector<gameObject*>::iterator i{ colliders.begin() }; i < colliders.end(); ++i)
+	Collider_List& colliders = plats.colliders;
+	for (Collider_List::iterator i{ colliders.begin() }; i < colliders.end(); ++i)
 	{
 		gameObject& obj_col = **i;
 		if (obj_col.type == GO_TYPE::GO_ENEMYATTACKCOLLIDER)
@@ -329,8 +327,8 @@ void plats_oncollide(gameObject& plats)
 *******************************************************************************/
 void fireball_oncollide(gameObject& fireball)
 {
-	vector<gameObject*>& colliders = fireball.colliders;
-	for (vector<gameObject*>::iterator i{ colliders.begin() }; i < colliders.end(); ++i)
+	Collider_List& colliders = fireball.colliders;
+	for (Collider_List::iterator i{ colliders.begin() }; i < colliders.end(); ++i)
 	{
 		gameObject& obj_col = **i;
 		if (obj_col.type == GO_TYPE::GO_DESTRUCTABLE)
@@ -346,15 +344,15 @@ void fireball_oncollide(gameObject& fireball)
 *******************************************************************************/
 void roots_oncollide(gameObject& roots)
 {
-	vector<gameObject*>& colliders = roots.colliders;
-	for (vector<gameObject*>::iterator i{ colliders.begin() }; i < colliders.end(); ++i)
+	Collider_List& colliders = roots.colliders;
+	for (Collider_List::iterator i{ colliders.begin() }; i < colliders.end(); ++i)
 	{
 		gameObject& obj_col = **i;
 		if (obj_col.type == GO_TYPE::GO_PLATFORM)
 		{
 			if ((timer_roots > 1.0f) && (j < 9))
 			{
-				Boss2* boss2 = dynamic_cast<Boss2*> (Level::boss);
+				Boss2* boss2 = go_cast<Boss2>(Level::boss);
 				boss2->lava_traps[j]->traps_type = TRAPS_TYPE::TRAPS_FIRE;
 				boss2->lava_traps[j]->flag = true;
 				boss2->lava_traps[j]->curr_pos.x = boss2->atkcol_roots[0]->curr_pos.x;
@@ -107,7 +107,7 @@ void boss2_attacks_unload()
 *******************************************************************************/
 void boss2_projectile_fireball(gameObject& gameObj)
 {
-	Boss2* boss2 = dynamic_cast<Boss2*> (&gameObj);
+	Boss2* boss2 = go_cast<Boss2>(&gameObj);
 	static particleSystem* particles_fireball;
 	static int num_of_shots = 0;
 	static int curr_fireball = 0;
@@ -189,7 +189,7 @@ void boss2_projectile_fireball(gameObject& gameObj)
 *******************************************************************************/
 void boss2_roots_attack(gameObject& gameObj)
 {
-	Boss2* boss2 = dynamic_cast<Boss2*> (&gameObj);
+	Boss2* boss2 = go_cast<Boss2>(&gameObj);
 	static particleSystem* particles_fireball;
 
 	if (!boss2) return;
@@ -367,7 +367,7 @@ void boss2_roots_attack(gameObject& gameObj)
 *******************************************************************************/
 void boss2_fireball_attack(gameObject& gameObj)
 {
-	Boss2* boss2 = dynamic_cast<Boss2*> (&gameObj);
+	Boss2* boss2 = go_cast<Boss2>(&gameObj);
 	static particleSystem* particles_fireball;
 	static int num_of_shots = 0;
 
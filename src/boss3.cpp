@@ -172,7 +172,7 @@ void Boss3::game_object_initialize()
 
 	for (int i{ 0 }; i < NUM_SWORDS; ++i)
 	{
-		swords[i] = dynamic_cast<Attack_Collider*>(push_object(GO_TYPE::GO_ENEMYATTACKCOLLIDER, nullptr));
+		swords[i] = go_cast<Attack_Collider>(push_object(GO_TYPE::GO_ENEMYATTACKCOLLIDER, nullptr));
 		swords[i]->type = GO_TYPE::GO_PROJECTILE;
 		swords[i]->obj_sprite->texture = pTexSword;
 		swords[i]->scale.y = 50.0f;
@@ -302,7 +302,7 @@ void Boss3::game_object_free()
 	delete obj_sprite;
 	for (int i{ 0 }; i < NUM_SWORDS; ++i)
 	{
-		delete swords[i]->obj_sprite;
+		release_attack_collider(swords[i]);
 	}
 }
 
@@ -355,7 +355,7 @@ void Boss3::take_damage(s32 damage)
 		AEVec2Add(&pParticlesystem->curr_pos, &pParticlesystem->position_offset, &pParticlesystem->curr_pos);
 		pParticlesystem->set_aabb();
 		pParticlesystem->lifetime = 0.05f;
-		pParticlesystem->behaviour = damage_taken;
+		pParticlesystem->kernel = damage_taken;
 		pParticlesystem->obj_sprite->flip_x = Level::player->curr_pos.x < curr_pos.x;
 	}
 
@@ -178,7 +178,7 @@ void boss_sword_slash(gameObject& gameObj)
 	static AEGfxVertexList* orig_mesh;
 	static AEVec2 orig_size;
 	static f32 translate_x, translate_y;
-	Boss3* boss = dynamic_cast<Boss3*> (&gameObj);
+	Boss3* boss = go_cast<Boss3>(&gameObj);
 	if (!boss) return;
 
 	Attack_Collider* collider = get_attack_collider(boss);
@@ -186,7 +186,7 @@ void boss_sword_slash(gameObject& gameObj)
 	if (!boss->setup)
 	{
 		// PUT ATTACK SETUPS HERE ( E.G. COLLIDER SPAWNS WHERE, ANY COUNTDOWNS ETC. )
-		collider = dynamic_cast<Attack_Collider*>(push_object(GO_TYPE::GO_BOSSATTACKCOLLIDER, boss));
+		collider = go_cast<Attack_Collider>(push_object(GO_TYPE::GO_BOSSATTACKCOLLIDER, boss));
 		orig_mesh = collider->obj_sprite->mesh;
 		orig_size = collider->obj_sprite->size;
 		collider->flag = true;
@@ -292,7 +292,7 @@ void boss_sword_slash(gameObject& gameObj)
 			boss->attack_timer = 2.0f;
 			boss->curr_vel.x = 0;
 			particleSystem* pParticleSystem = create_particlesystem(boss);
-			pParticleSystem->behaviour = slam_particle;
+			pParticleSystem->kernel = slam_particle;
 			pParticleSystem->obj_sprite->texture = pTex_dust;
 			pParticleSystem->lifetime = 0.25f;
 			pParticleSystem->emission_rate = 0.02f;
@@ -436,7 +436,7 @@ void boss_sword_stab(gameObject& gameObj)
 	static f32 translate_x, translate_y;
 	static particleSystem* pIndicatorParticle{ nullptr };
 
-	Boss3* boss = dynamic_cast<Boss3*>(&gameObj);
+	Boss3* boss = go_cast<Boss3>(&gameObj);
 	if (!boss)
 		return;
 
@@ -445,7 +445,7 @@ void boss_sword_stab(gameObject& gameObj)
 	if (!boss->setup)
 	{
 		// PUT ATTACK SETUPS HERE ( E.G. COLLIDER SPAWNS WHERE, ANY COUNTDOWNS ETC. )
-		collider = dynamic_cast<Attack_Collider*>(push_object(GO_TYPE::GO_BOSSATTACKCOLLIDER, boss));
+		collider = go_cast<Attack_Collider>(push_object(GO_TYPE::GO_BOSSATTACKCOLLIDER, boss));
 		collider->flag = true;
 		collider->curr_pos.x = boss->is_facing_right ? boss->curr_pos.x + 30 : boss->curr_pos.x - 30;
 		collider->curr_pos.y = boss->curr_pos.y + 80;
@@ -474,10 +474,11 @@ void boss_sword_stab(gameObject& gameObj)
 		{
 			pIndicatorParticle = create_particlesystem({ boss->curr_pos });
 			pIndicatorParticle->loop = true;
+			pIndicatorParticle->priority = PARTICLE_PRIORITY::ESSENTIAL;
 			pIndicatorParticle->obj_sprite->flip_x = !boss->is_facing_right;
 			pIndicatorParticle->scale = { 1, 1 };
 			pIndicatorParticle->max_particles = 4;
-			pIndicatorParticle->behaviour = nullptr;
+			pIndicatorParticle->kernel = {};
 			pIndicatorParticle->obj_sprite->texture = pTex_arrow;
 			pIndicatorParticle->color_range[0] = { 1.0f, 1.0f, 1.0f, 0.5f };
 			pIndicatorParticle->color_range[1] = { 1.0f, 1.0f, 1.0f, 0.5f };
@@ -744,7 +745,7 @@ void boss_sword_big_sword(gameObject& gameObj)
 	AEGfxGetCamPosition(&camPos.x, &camPos.y);
 	static f32 rotation;
 
-	Boss3* boss = dynamic_cast<Boss3*> (&gameObj);
+	Boss3* boss = go_cast<Boss3>(&gameObj);
 	if (!boss) return;
 
 	Attack_Collider* collider = get_attack_collider(boss);
@@ -752,7 +753,7 @@ void boss_sword_big_sword(gameObject& gameObj)
 	if (!boss->setup)
 	{
 		// PUT ATTACK SETUPS HERE ( E.G. COLLIDER SPAWNS WHERE, ANY COUNTDOWNS ETC. )
-		collider = dynamic_cast<Attack_Collider*>(push_object(GO_TYPE::GO_BOSSATTACKCOLLIDER, boss));
+		collider = go_cast<Attack_Collider>(push_object(GO_TYPE::GO_BOSSATTACKCOLLIDER, boss));
 		collider->flag = true;
 		collider->curr_pos.x = boss->curr_pos.x;
 		collider->curr_pos.y = camPos.y + static_cast<f32>(AEGetWindowHeight()) / 2 + 225;
@@ -977,7 +978,7 @@ void boss_ultimate(gameObject& gameObj)
 	static f32 timer;
 	static u16 curr_sword;
 
-	Boss3* boss = dynamic_cast<Boss3*> (&gameObj);
+	Boss3* boss = go_cast<Boss3>(&gameObj);
 	if (!boss) return;
 
 	if (!boss->setup)
@@ -1104,9 +1105,9 @@ void big_sword_collide(gameObject& obj)
 {
 	particleSystem* pParticleSystem = nullptr;
 
-	Attack_Collider* collider = dynamic_cast<Attack_Collider*>(&obj);
-	vector<gameObject*>& colliders = obj.colliders;
-	for (vector<gameObject*>::iterator i = colliders.begin(); i != colliders.end(); ++i)
+	Attack_Collider* collider = go_cast<Attack_Collider>(&obj);
+	Collider_List& colliders = obj.colliders;
+	for (Collider_List::iterator i = colliders.begin(); i != colliders.end(); ++i)
 	{
 		gameObject& obj_col = **i;
 		if (obj_col.type == GO_TYPE::GO_PLATFORM)
@@ -1185,14 +1186,14 @@ void setup_sword(Boss3* boss, u16 swordNo)
 *******************************************************************************/
 void stab_collide(gameObject& obj)
 {
-	Attack_Collider* collider = dynamic_cast<Attack_Collider*>(&obj);
-	vector<gameObject*>& colliders = obj.colliders;
-	for (vector<gameObject*>::iterator i = colliders.begin(); i != colliders.end(); ++i)
+	Attack_Collider* collider = go_cast<Attack_Collider>(&obj);
+	Collider_List& colliders = obj.colliders;
+	for (Collider_List::iterator i = colliders.begin(); i != colliders.end(); ++i)
 	{
 		gameObject& obj_col = **i;
 		if (obj_col.type == GO_TYPE::GO_WALL)
 		{
-			Boss3* boss = dynamic_cast<Boss3*>(collider->owner);
+			Boss3* boss = go_cast<Boss3>(collider->owner);
 			Camera::shake(10.0f, 0.5f);
 			collider->on_collide = nullptr;
 			collider->flag = false;
@@ -1214,7 +1215,7 @@ void stab_collide(gameObject& obj)
 
 		else if (obj_col.type == GO_TYPE::GO_PLAYER)
 		{
-			Boss3* boss = dynamic_cast<Boss3*>(collider->owner);
+			Boss3* boss = go_cast<Boss3>(collider->owner);
 			collider->curr_pos.x = boss->is_facing_right ? boss->curr_pos.x + 30 : boss->curr_pos.x - 30;
 			collider->curr_pos.y = boss->curr_pos.y;
 			collider->scale = { 300, 50 };
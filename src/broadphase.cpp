@@ -0,0 +1,690 @@
+/*!*************************************************************************
+****
+\file   broadphase.cpp
+\author agent
+\par    email: agent\@local
+\date   Oct 17 2026
+
+\brief
+This file contains the implementation of the broadphase of the collision
+system in the game engine.
+
+Every active game object is inserted into each cell of a uniform grid that
+its bounding box touches. Two objects can only collide if they share at least
+one cell, so candidate pairs are only emitted between objects of the same
+cell. Objects that are too large for the grid are tested against every other
+active object instead.
+
+Static level geometry (platforms, walls and the boss spawner) is kept in its
+own grid which is built once per level. Only the moving objects are bucketed
+every frame, and they query the static grid for the cells they touch, so the
+static objects never have to be paired with each other.
+
+Objects that move further than their own size in a frame are bounded by the
+whole distance they moved, so that the narrowphase can sweep them.
+
+The grid can be swapped at runtime for a sweep along x, which suits the
+side scrolling levels, or for the all-pairs loop, to compare them.
+
+The functions include:
+- get_sweep
+- get_swept_aabb
+- broadphase_set_static
+- broadphase_clear
+- broadphase_find_pairs
+- broadphase_find_terrain
+- set_broadphase_mode
+- get_broadphase_mode
+- get_collision_stats
+
+Copyright (C) 2026 DigiPen Institure of Technology.
+Reproduction or disclosure of this file or its contents
+without the prior written consent of DigiPen Institute of
+Technology is prohibited.
+****************************************************************************
+***/
+#include "main.h"
+#include <cfloat>
+#include "broadphase.h"
+
+struct Cell_Entry
+{
+	u64 cell;
+	u32 index;
+	bool operator<(const Cell_Entry& rhs) const
+	{
+		return cell < rhs.cell || (cell == rhs.cell && index < rhs.index);
+	}
+};
+
+constexpr u32 INVALID_INDEX = 0xFFFFFFFF;
+
+// Kept between frames so that the broadphase does not allocate once warmed up
+static vector<Cell_Entry> v_entries;
+static vector<u32> v_oversized;
+static vector<u32> v_active;
+static Collision_Stats stats;
+
+// Static grid, where the index of each entry is the slot in v_static
+static vector<gameObject*> v_static;
+static vector<Cell_Entry> v_static_entries;
+static vector<u32> v_static_oversized;
+static vector<u32> v_static_index; // index of each static object in v_obj this frame
+static bool static_dirty = false;
+// Static objects sorted by address, reused by every rebuild of the static grid
+static vector<gameObject*> v_static_lookup;
+
+struct Sweep_Entry
+{
+	f32 min_x;
+	f32 max_x;
+	u32 index;
+};
+
+// Objects sorted by their left edge, kept between frames for the sweep
+static vector<Sweep_Entry> v_sweep;
+static vector<Sweep_Entry> v_open;
+static BROADPHASE_MODE mode = BROADPHASE_MODE::GRID;
+
+/*!****************************************************************************
+ * @brief Packs two object indices into a single pair key. The smaller index
+ * is stored in the upper half so that sorting the keys reproduces the
+ * visiting order of the all-pairs loop.
+ *
+ * @param a
+ * Index of the first object
+ * @param b
+ * Index of the second object
+ * @return u64
+ * Pair key
+******************************************************************************/
+static inline u64 make_pair_key(u32 a, u32 b)
+{
+	return a < b ? (static_cast<u64>(a) << 32) | b : (static_cast<u64>(b) << 32) | a;
+}
+
+/*!****************************************************************************
+ * @brief Gets how far a game object moved this frame, and whether it moved
+ * far enough to pass through something. An object can only skip over another
+ * if it moves further than its own size in a frame.
+ *
+ * @param obj
+ * Game object to check
+ * @param displacement
+ * Distance moved this frame
+ * @return true
+ * The object is moving fast and has to be swept
+ * @return false
+ * The object is static, asleep or slow
+******************************************************************************/
+bool get_sweep(const gameObject& obj, AEVec2& displacement)
+{
+	if (obj.is_static || obj.is_asleep)
+		return false;
+	displacement.x = obj.curr_vel.x * G_DELTATIME;
+	displacement.y = obj.curr_vel.y * G_DELTATIME;
+	return fabsf(displacement.x) > obj.bounding_box.max.x - obj.bounding_box.min.x ||
+		fabsf(displacement.y) > obj.bounding_box.max.y - obj.bounding_box.min.y;
+}
+
+/*!****************************************************************************
+ * @brief Gets the bounds of a game object used by the broadphase. Fast
+ * objects are bounded from where they started the frame to where they are
+ * now, so that anything they passed through is still paired with them.
+ *
+ * @param obj
+ * Game object to bound
+ * @return AABB
+ * Bounding box covering the movement of the object this frame
+******************************************************************************/
+AABB get_swept_aabb(const gameObject& obj)
+{
+	AEVec2 displacement;
+	if (!get_sweep(obj, displacement))
+		return obj.bounding_box;
+	AABB aabb = obj.bounding_box;
+	aabb.min.x = AEMin(aabb.min.x, aabb.min.x - displacement.x);
+	aabb.min.y = AEMin(aabb.min.y, aabb.min.y - displacement.y);
+	aabb.max.x = AEMax(aabb.max.x, aabb.max.x - displacement.x);
+	aabb.max.y = AEMax(aabb.max.y, aabb.max.y - displacement.y);
+	return aabb;
+}
+
+/*!****************************************************************************
+ * @brief Checks if an object can move into others this frame
+ *
+ * @param obj
+ * Game object to check
+ * @return true
+ * The object is awake and not static
+ * @return false
+ * The object stays where it is
+******************************************************************************/
+static inline bool is_moving(const gameObject* obj)
+{
+	return !obj->is_static && !obj->is_asleep;
+}
+
+/*!****************************************************************************
+ * @brief Checks if a pair of objects has to be tested. Pairs of objects that
+ * are static or asleep never move into each other, and pairs that neither
+ * on_collide function reads are filtered by the collision mask of their
+ * types.
+ *
+ * @param a
+ * First game object
+ * @param b
+ * Second game object
+ * @return true
+ * The pair is handed to the narrowphase
+ * @return false
+ * The pair is skipped
+******************************************************************************/
+static inline bool should_test(const gameObject* a, const gameObject* b)
+{
+	return (is_moving(a) || is_moving(b)) && go_types_interact(a->type, b->type);
+}
+
+/*!****************************************************************************
+ * @brief Checks if an object takes part in the broadphase. Sleeping objects
+ * keep their place as passive candidates, only paired with awake moving
+ * objects, so that a spear thrown away from the camera still hits them and
+ * wakes them up.
+ *
+ * @param obj
+ * Game object to check
+ * @return true
+ * The object is paired with the others
+ * @return false
+ * The object is skipped
+******************************************************************************/
+static inline bool is_active(const gameObject* obj)
+{
+	return obj->flag;
+}
+
+/*!****************************************************************************
+ * @brief Packs a cell coordinate into a single key
+ *
+ * @param x
+ * Column of the cell
+ * @param y
+ * Row of the cell
+ * @return u64
+ * Cell key
+******************************************************************************/
+static inline u64 make_cell_key(s32 x, s32 y)
+{
+	return (static_cast<u64>(static_cast<u32>(x)) << 32) | static_cast<u32>(y);
+}
+
+/*!****************************************************************************
+ * @brief Gets the range of cells covered by a bounding box
+ *
+ * @param aabb
+ * Bounding box of the object
+ * @param min
+ * Lowest cell touched by the box
+ * @param max
+ * Highest cell touched by the box
+ * @return true
+ * The box fits in the grid
+ * @return false
+ * The box is not finite or covers more than BROADPHASE_MAX_CELLS cells
+******************************************************************************/
+static bool get_cell_range(const AABB& aabb, s32 min[2], s32 max[2])
+{
+	f32 bounds[4]{ aabb.min.x, aabb.min.y, aabb.max.x, aabb.max.y };
+	for (f32 f : bounds)
+	{
+		// Rejects NaN as well as anything too far to be bucketed
+		if (!(fabsf(f) < BROADPHASE_CELL_SIZE * 1048576.0f))
+			return false;
+	}
+	min[0] = static_cast<s32>(floorf(aabb.min.x / BROADPHASE_CELL_SIZE));
+	min[1] = static_cast<s32>(floorf(aabb.min.y / BROADPHASE_CELL_SIZE));
+	max[0] = static_cast<s32>(floorf(aabb.max.x / BROADPHASE_CELL_SIZE));
+	max[1] = static_cast<s32>(floorf(aabb.max.y / BROADPHASE_CELL_SIZE));
+	s64 cells = (static_cast<s64>(max[0]) - min[0] + 1) * (static_cast<s64>(max[1]) - min[1] + 1);
+	return cells > 0 && cells <= BROADPHASE_MAX_CELLS;
+}
+
+/*!****************************************************************************
+ * @brief Sets the static objects of the level. The static grid is rebuilt on
+ * the next call to broadphase_find_pairs, once the game objects have been
+ * sorted. The objects must not move for as long as they are in the grid.
+ *
+ * @param v_static_objects
+ * Vector of static game objects of the level
+******************************************************************************/
+void broadphase_set_static(const vector<gameObject*>& v_static_objects)
+{
+	v_static = v_static_objects;
+	static_dirty = true;
+}
+
+/*!****************************************************************************
+ * @brief Removes all objects from the broadphase. Called when the level
+ * unloads so that no deleted object is kept in the static grid.
+ *
+******************************************************************************/
+void broadphase_clear()
+{
+	v_static.clear();
+	v_static_entries.clear();
+	v_static_oversized.clear();
+	v_static_index.clear();
+	v_static_lookup.clear();
+	v_entries.clear();
+	v_oversized.clear();
+	v_active.clear();
+	v_sweep.clear();
+	v_open.clear();
+	static_dirty = false;
+}
+
+/*!****************************************************************************
+ * @brief Builds the static grid. The static objects are ordered the same way
+ * as v_obj so that each frame they can be matched against v_obj in a single
+ * pass without dereferencing them.
+ *
+ * @param v_obj
+ * Vector of game objects holding the static objects
+******************************************************************************/
+static void build_static(const vector<gameObject*>& v_obj)
+{
+	// Walking v_obj in order puts the static objects in its order, and drops
+	// the ones that are no longer in it
+	v_static_lookup.assign(v_static.begin(), v_static.end());
+	std::sort(v_static_lookup.begin(), v_static_lookup.end());
+	v_static.clear();
+	for (gameObject* obj : v_obj)
+	{
+		if (std::binary_search(v_static_lookup.begin(), v_static_lookup.end(), obj))
+			v_static.push_back(obj);
+	}
+
+	v_static_entries.clear();
+	v_static_oversized.clear();
+	v_static_index.assign(v_static.size(), INVALID_INDEX);
+	for (u32 i{ 0 }; i < v_static.size(); ++i)
+	{
+		gameObject* obj = v_static[i];
+		// Objects that have never been active have not set their bounds yet
+		obj->set_aabb();
+		s32 min[2], max[2];
+		if (!get_cell_range(obj->bounding_box, min, max))
+		{
+			v_static_oversized.push_back(i);
+			continue;
+		}
+		for (s32 x{ min[0] }; x <= max[0]; ++x)
+		{
+			for (s32 y{ min[1] }; y <= max[1]; ++y)
+			{
+				v_static_entries.push_back({ make_cell_key(x, y), i });
+			}
+		}
+	}
+	std::sort(v_static_entries.begin(), v_static_entries.end());
+	static_dirty = false;
+}
+
+/*!****************************************************************************
+ * @brief Finds the candidate pairs with the uniform grid. Moving objects are
+ * paired with each other through the grid built this frame, and with the
+ * static objects through the static grid.
+ *
+ * @param v_obj
+ * Vector of game objects to check
+ * @param pairs
+ * Output vector of candidate pairs
+******************************************************************************/
+static void find_pairs_grid(const vector<gameObject*>& v_obj, vector<u64>& pairs)
+{
+	v_entries.clear();
+	v_oversized.clear();
+	v_active.clear();
+
+	if (static_dirty)
+		build_static(v_obj);
+
+	// Static objects appear in v_obj in the same order as v_static
+	u32 static_count{ 0 };
+	for (u32 i{ 0 }; i < v_obj.size(); ++i)
+	{
+		const gameObject* obj = v_obj[i];
+		if (static_count < v_static.size() && obj == v_static[static_count])
+		{
+			v_static_index[static_count++] = i;
+			continue;
+		}
+		if (!is_active(obj))
+			continue;
+		v_active.push_back(i);
+		s32 min[2], max[2];
+		if (!get_cell_range(get_swept_aabb(*obj), min, max))
+		{
+			v_oversized.push_back(i);
+			continue;
+		}
+		for (s32 x{ min[0] }; x <= max[0]; ++x)
+		{
+			for (s32 y{ min[1] }; y <= max[1]; ++y)
+			{
+				v_entries.push_back({ make_cell_key(x, y), i });
+			}
+		}
+	}
+	if (static_count < v_static.size())
+	{
+		// A static object left v_obj, the static grid is rebuilt next frame
+		std::fill(v_static_index.begin() + static_count, v_static_index.end(), INVALID_INDEX);
+		static_dirty = true;
+	}
+	std::sort(v_entries.begin(), v_entries.end());
+
+	for (size_t begin{ 0 }; begin < v_entries.size();)
+	{
+		size_t end = begin + 1;
+		while (end < v_entries.size() && v_entries[end].cell == v_entries[begin].cell)
+			++end;
+
+		// Emit pairs between every moving object sharing a cell
+		for (size_t i{ begin }; i < end; ++i)
+		{
+			const gameObject* a = v_obj[v_entries[i].index];
+			for (size_t j{ i + 1 }; j < end; ++j)
+			{
+				if (should_test(a, v_obj[v_entries[j].index]))
+					pairs.push_back(make_pair_key(v_entries[i].index, v_entries[j].index));
+			}
+		}
+
+		// Emit pairs between the moving objects and the static objects of the cell
+		Cell_Entry first{ v_entries[begin].cell, 0 };
+		for (vector<Cell_Entry>::const_iterator s = std::lower_bound(v_static_entries.begin(), v_static_entries.end(), first);
+			s != v_static_entries.end() && s->cell == first.cell; ++s)
+		{
+			u32 index = v_static_index[s->index];
+			if (index == INVALID_INDEX || !v_obj[index]->flag)
+				continue;
+			for (size_t i{ begin }; i < end; ++i)
+			{
+				if (should_test(v_obj[v_entries[i].index], v_obj[index]))
+					pairs.push_back(make_pair_key(v_entries[i].index, index));
+			}
+		}
+		begin = end;
+	}
+
+	// Oversized objects could touch anything
+	for (u32 i : v_oversized)
+	{
+		for (u32 j : v_active)
+		{
+			if (i != j && should_test(v_obj[i], v_obj[j]))
+				pairs.push_back(make_pair_key(i, j));
+		}
+		if (!is_moving(v_obj[i]))
+			continue;
+		for (u32 index : v_static_index)
+		{
+			if (index != INVALID_INDEX && v_obj[index]->flag && should_test(v_obj[i], v_obj[index]))
+				pairs.push_back(make_pair_key(i, index));
+		}
+	}
+	for (u32 s : v_static_oversized)
+	{
+		u32 index = v_static_index[s];
+		if (index == INVALID_INDEX || !v_obj[index]->flag)
+			continue;
+		for (u32 j : v_active)
+		{
+			if (should_test(v_obj[j], v_obj[index]))
+				pairs.push_back(make_pair_key(j, index));
+		}
+	}
+
+	stats.objects = static_cast<u32>(v_active.size());
+	stats.static_objects = static_cast<u32>(v_static.size());
+}
+
+/*!****************************************************************************
+ * @brief Finds the candidate pairs by sweeping along x. The objects are kept
+ * sorted by the left edge of their bounding box between frames, so the
+ * insertion sort only has to move the few objects that passed each other.
+ * Every object that is still open when another one starts overlaps it on x.
+ *
+ * @param v_obj
+ * Vector of game objects to check
+ * @param pairs
+ * Output vector of candidate pairs
+******************************************************************************/
+static void find_pairs_sweep(const vector<gameObject*>& v_obj, vector<u64>& pairs)
+{
+	v_oversized.clear();
+	v_active.clear();
+
+	// Keep v_sweep a list of every index of v_obj, new objects start at the end
+	u32 count = static_cast<u32>(v_obj.size());
+	if (v_sweep.size() != count)
+	{
+		v_sweep.erase(std::remove_if(v_sweep.begin(), v_sweep.end(),
+			[count](const Sweep_Entry& entry) { return entry.index >= count; }), v_sweep.end());
+		for (u32 i = static_cast<u32>(v_sweep.size()); i < count; ++i)
+			v_sweep.push_back({ 0.0f, 0.0f, i });
+	}
+
+	for (Sweep_Entry& entry : v_sweep)
+	{
+		AABB aabb = get_swept_aabb(*v_obj[entry.index]);
+		entry.min_x = aabb.min.x;
+		entry.max_x = aabb.max.x;
+		// Keeps the sort well ordered, such boxes are tested against everything
+		if (!(fabsf(entry.min_x) < FLT_MAX) || !(fabsf(entry.max_x) < FLT_MAX))
+			entry.min_x = -FLT_MAX;
+	}
+	for (size_t i{ 1 }; i < v_sweep.size(); ++i)
+	{
+		Sweep_Entry entry = v_sweep[i];
+		size_t j = i;
+		for (; j > 0 && entry.min_x < v_sweep[j - 1].min_x; --j)
+			v_sweep[j] = v_sweep[j - 1];
+		v_sweep[j] = entry;
+	}
+
+	v_open.clear();
+	for (const Sweep_Entry& entry : v_sweep)
+	{
+		const gameObject* obj = v_obj[entry.index];
+		if (!is_active(obj))
+			continue;
+		v_active.push_back(entry.index);
+		if (entry.min_x == -FLT_MAX)
+		{
+			v_oversized.push_back(entry.index);
+			continue;
+		}
+
+		// Close every object that ends before this one starts
+		v_open.erase(std::remove_if(v_open.begin(), v_open.end(),
+			[&entry](const Sweep_Entry& open) { return open.max_x < entry.min_x; }), v_open.end());
+		for (const Sweep_Entry& open : v_open)
+		{
+			if (should_test(obj, v_obj[open.index]))
+				pairs.push_back(make_pair_key(entry.index, open.index));
+		}
+		v_open.push_back(entry);
+	}
+
+	for (u32 i : v_oversized)
+	{
+		for (u32 j : v_active)
+		{
+			if (i != j && should_test(v_obj[i], v_obj[j]))
+				pairs.push_back(make_pair_key(i, j));
+		}
+	}
+
+	stats.objects = static_cast<u32>(v_active.size());
+	stats.static_objects = 0;
+}
+
+/*!****************************************************************************
+ * @brief Finds the candidate pairs by pairing every active object with every
+ * other active object, the same as collision_update did before the
+ * broadphase.
+ *
+ * @param v_obj
+ * Vector of game objects to check
+ * @param pairs
+ * Output vector of candidate pairs
+******************************************************************************/
+static void find_pairs_brute_force(const vector<gameObject*>& v_obj, vector<u64>& pairs)
+{
+	v_active.clear();
+	for (u32 i{ 0 }; i < v_obj.size(); ++i)
+	{
+		if (is_active(v_obj[i]))
+			v_active.push_back(i);
+	}
+	for (size_t i{ 0 }; i < v_active.size(); ++i)
+	{
+		for (size_t j{ i + 1 }; j < v_active.size(); ++j)
+		{
+			if (should_test(v_obj[v_active[i]], v_obj[v_active[j]]))
+				pairs.push_back(make_pair_key(v_active[i], v_active[j]));
+		}
+	}
+
+	stats.objects = static_cast<u32>(v_active.size());
+	stats.static_objects = 0;
+}
+
+/*!****************************************************************************
+ * @brief Finds every pair of game objects whose bounding boxes may overlap.
+ * Inactive objects, pairs of objects that are static or asleep and pairs of
+ * types that do not interact are skipped. The resulting pair keys
+ * are sorted and unique, with the index of each object in v_obj packed by
+ * make_pair_key.
+ *
+ * The pairs are found with the method set by set_broadphase_mode.
+ *
+ * @param v_obj
+ * Vector of game objects to check
+ * @param pairs
+ * Output vector of candidate pairs
+******************************************************************************/
+void broadphase_find_pairs(const vector<gameObject*>& v_obj, vector<u64>& pairs)
+{
+	pairs.clear();
+	switch (mode)
+	{
+	case BROADPHASE_MODE::BRUTE_FORCE:
+		find_pairs_brute_force(v_obj, pairs);
+		break;
+	case BROADPHASE_MODE::SWEEP_AND_PRUNE:
+		find_pairs_sweep(v_obj, pairs);
+		break;
+	default:
+		find_pairs_grid(v_obj, pairs);
+		break;
+	}
+
+	// Objects sharing several cells are emitted more than once
+	std::sort(pairs.begin(), pairs.end());
+	pairs.erase(std::unique(pairs.begin(), pairs.end()), pairs.end());
+
+	u32 total = stats.objects + stats.static_objects;
+	stats.brute_force_pairs = total * (total - (total ? 1 : 0)) / 2;
+	stats.mode = mode;
+}
+
+/*!****************************************************************************
+ * @brief Finds the platforms and walls that overlap a bounding box, whatever
+ * the collision mask of the object it belongs to. The static grid is used if
+ * the pairs of this frame were found with it, otherwise every object is
+ * checked. Must be called after broadphase_find_pairs.
+ *
+ * @param v_obj
+ * Vector of game objects passed to broadphase_find_pairs
+ * @param aabb
+ * Bounding box to check
+ * @param indices
+ * Output vector of the index in v_obj of each platform and wall found
+******************************************************************************/
+void broadphase_find_terrain(const vector<gameObject*>& v_obj, const AABB& aabb, vector<u32>& indices)
+{
+	indices.clear();
+	s32 min[2], max[2];
+	if (mode == BROADPHASE_MODE::GRID && get_cell_range(aabb, min, max))
+	{
+		for (s32 x{ min[0] }; x <= max[0]; ++x)
+		{
+			for (s32 y{ min[1] }; y <= max[1]; ++y)
+			{
+				Cell_Entry first{ make_cell_key(x, y), 0 };
+				for (vector<Cell_Entry>::const_iterator s = std::lower_bound(v_static_entries.begin(), v_static_entries.end(), first);
+					s != v_static_entries.end() && s->cell == first.cell; ++s)
+				{
+					indices.push_back(v_static_index[s->index]);
+				}
+			}
+		}
+		for (u32 s : v_static_oversized)
+			indices.push_back(v_static_index[s]);
+		// Objects spanning several cells are found more than once
+		std::sort(indices.begin(), indices.end());
+		indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+	}
+	else
+	{
+		for (u32 i{ 0 }; i < v_obj.size(); ++i)
+			indices.push_back(i);
+	}
+
+	indices.erase(std::remove_if(indices.begin(), indices.end(), [&v_obj, &aabb](u32 index)
+		{
+			if (index == INVALID_INDEX)
+				return true;
+			const gameObject* obj = v_obj[index];
+			if (!obj->flag || !obj->is_static || (obj->type != GO_TYPE::GO_PLATFORM && obj->type != GO_TYPE::GO_WALL))
+				return true;
+			return aabb.max.x < obj->bounding_box.min.x || aabb.max.y < obj->bounding_box.min.y ||
+				aabb.min.x > obj->bounding_box.max.x || aabb.min.y > obj->bounding_box.max.y;
+		}), indices.end());
+}
+
+/*!****************************************************************************
+ * @brief Sets the method used to find candidate pairs
+ *
+ * @param broadphase_mode
+ * Method to use from the next collision update
+******************************************************************************/
+void set_broadphase_mode(BROADPHASE_MODE broadphase_mode)
+{
+	mode = broadphase_mode;
+}
+
+/*!****************************************************************************
+ * @brief Gets the method used to find candidate pairs
+ *
+ * @return BROADPHASE_MODE
+ * Method in use
+******************************************************************************/
+BROADPHASE_MODE get_broadphase_mode()
+{
+	return mode;
+}
+
+/*!****************************************************************************
+ * @brief Gets the collision counters of the last collision update
+ *
+ * @return Collision_Stats&
+ * Reference to the collision counters
+******************************************************************************/
+Collision_Stats& get_collision_stats()
+{
+	return stats;
+}
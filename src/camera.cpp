@@ -245,6 +245,19 @@ AEVec2 Camera::get_camera_scale(void)
 	return Camera::zoom;
 }
 
+/******************************************************************************
+ * @brief Returns the area of the world seen by the camera, taking the zoom
+ * into account
+ *
+ * @param margin
+ * Distance to grow the area by on every side
+******************************************************************************/
+AABB Camera::get_view(f32 margin)
+{
+	AEVec2 half{ windows_x / (2 * zoom.x) + margin, windows_y / (2 * zoom.y) + margin };
+	return { { curr_pos.x - half.x, curr_pos.y - half.y }, { curr_pos.x + half.x, curr_pos.y + half.y } };
+}
+
 /******************************************************************************
  * @brief Shakes the camera by shake_intensity if the shake_timer
  * is more than 0.
@@ -5,18 +5,28 @@
 \date   March 12 2021
 
 \brief
-This file contains the implementation of all functions related Heart game
-objects as outlined in collectables.h
+This file contains the implementation of all functions related to collectable
+game objects as outlined in collectables.h
+
+Collectables live in a pool created when the level loads. The pool is in
+v_gameObjects for the whole level and its collectables are only switched on
+and off, so dropping and picking them up never allocates or erases from the
+vector. When every collectable is in use, the oldest one is taken for the
+new drop. Each type of collectable is described by an entry of
+collectable_descs, so new drops only need a new entry.
 
 The functions include:
-- Heart::Heart (default constructor)
-- heart_load
-- Heart::game_object_initialize
-- Heart::game_object_update
-- heart_unload
-- adjust_heart_movement
-- collectables_collide
-- spawn_heart
+- Collectable::Collectable (default and type constructor)
+- Collectable::game_object_update
+- collectables_load
+- collectables_unload
+- link_collectable
+- unlink_collectable
+- spawn_collectable
+- release_collectable
+- collectable_pick_up
+- spawn_drop
+- get_collectable_stats
 
 Copyright (C) 2021 DigiPen Institure of Technology.
 Reproduction or disclosure of this file or its contents
@@ -26,170 +36,313 @@ Technology is prohibited.
 #include "collectables.h"
 #include "level_manager.h"
 
-static AEGfxTexture* pTexHeart;
-static AEGfxVertexList* pMeshHeart;
-static Sprite* pSpriteHeart;
-static AEVec2 HEART_SCALE = { 50.0f, 50.0f };
-Audio* Heart::pick_up_sound;
+struct Collectable_Desc
+{
+	const char* texture;
+	const char* pick_up_sound;
+	AEVec2 scale;
+	f32 launch_speed;	// upwards speed when spawned
+	f32 drop_chance;	// chance of being dropped by a defeated enemy
+};
+
+static const Collectable_Desc collectable_descs[static_cast<int>(COLLECTABLE_TYPE::TOTAL)] =
+{
+	{ "./Sprites/fullheart.png", "./Audio/pickup.wav", { 50.0f, 50.0f }, 1000.0f, 0.2f }	// HEART
+};
+
+static AEGfxVertexList* pMeshCollectable;
+static AEGfxTexture* collectable_textures[static_cast<int>(COLLECTABLE_TYPE::TOTAL)];
+static Sprite* collectable_sprites[static_cast<int>(COLLECTABLE_TYPE::TOTAL)];
+static Audio* pick_up_sounds[static_cast<int>(COLLECTABLE_TYPE::TOTAL)];
+
+// Reserved up front so the collectables never move. Each collectable keeps
+// its transform in the transform store for the whole level.
+static vector<Collectable> v_pool_collectables;
+static vector<bool> v_pool_used;
+// Indices of the collectables not in use, taken from and returned to the back
+static vector<u32> v_pool_free;
+static Collectable_Stats pool_stats;
+// The collectables in use form a list from the oldest to the newest, so the
+// oldest can be taken when the pool is full
+constexpr u32 NO_COLLECTABLE = ~0u;
+static vector<u32> v_pool_older;
+static vector<u32> v_pool_newer;
+static u32 pool_oldest = NO_COLLECTABLE, pool_newest = NO_COLLECTABLE;
 
 /*!*****************************************************************************
   \brief
-	Default constructor for the Heart class. Calls gameObject's default
-	constructor and sets variables to the default values for hearts.
+	Default constructor for the Collectable class. Used for the collectables
+	of the pool that have not been spawned yet.
+
+  \param transform
+	Slot in the transform store to keep the transform in, NO_TRANSFORM by
+	default
 *******************************************************************************/
-Heart::Heart()
-	: gameObject()
+Collectable::Collectable(u32 transform)
+	: gameObject(transform), collectable_type{ COLLECTABLE_TYPE::HEART }
 {
 	type = GO_TYPE::GO_COLLECTABLES;
-	scale = HEART_SCALE;
 	is_static = false;
-	on_collide = collectables_collide;
+	flag = false;
 }
 
 /*!*****************************************************************************
   \brief
-	Loads all assets required for the creation and the picking up of heart
-	objects. Called once at the load function of each level.
-*******************************************************************************/
-void heart_load()
-{
-	pTexHeart = AEGfxTextureLoad("./Sprites/fullheart.png");
-	AE_ASSERT_MESG(pTexHeart, "Failed to create heart texture!");
-	pMeshHeart = create_square_mesh(1.0f, 1.0f);
-	AE_ASSERT_MESG(pMeshHeart, "Failed to create heart mesh!");
-	Heart::pick_up_sound = new Audio("./Audio/pickup.wav", AUDIO_GROUP::SFX);
-	pSpriteHeart = new Sprite(pTexHeart, pMeshHeart, HEART_SCALE);
-}
+	Constructs a collectable of a type, launched upwards from a position.
 
-/*!*****************************************************************************
-  \brief
-	Initialize function for Heart objects, overriding the default game object
-	initialize function. Sets the sprite of each created sprite to the same
-	sprite, and sets the initial velocity of the heart objects created
+  \param collectable_type
+	The type of the collectable
+
+  \param pos
+	The position to spawn the collectable at
 *******************************************************************************/
-void Heart::game_object_initialize()
+Collectable::Collectable(COLLECTABLE_TYPE collectable_type, AEVec2 pos)
+	: gameObject(), collectable_type{ collectable_type }
 {
-	obj_sprite = pSpriteHeart;
-	curr_vel.y = 1000.0f;
+	const Collectable_Desc& desc = collectable_descs[static_cast<int>(collectable_type)];
+	type = GO_TYPE::GO_COLLECTABLES;
+	is_static = false;
+	scale = desc.scale;
+	obj_sprite = collectable_sprites[static_cast<int>(collectable_type)];
+	curr_pos = pos;
+	curr_vel.y = desc.launch_speed;
+	set_aabb();
 }
 
 /*!*****************************************************************************
   \brief
-	Update function for Heart objects, overriding the default game object update
-	function. Adds gravity to the Heart object's velocity and calculates its new
-	position.
+	Update function for collectables, overriding the default game object update
+	function. Adds gravity to the collectable's velocity and calculates its new
+	position, unless the collectable is moved by the transform store.
 *******************************************************************************/
-void Heart::game_object_update()
+void Collectable::game_object_update()
 {
+	if (transform != NO_TRANSFORM)
+		return;
+
 	acceleration.y += LEVEL_GRAVITY;
 	AEVec2Add(&curr_vel, &curr_vel, &acceleration);
 	AEVec2Zero(&acceleration);
 
 	AEVec2 dt_vel;
 	AEVec2Scale(&dt_vel, &curr_vel, G_DELTATIME);
-	AEVec2Add(&curr_pos, &curr_pos, &dt_vel);
+	AEVec2Add(&curr_pos, &dt_vel, &curr_pos);
 }
 
 /*!*****************************************************************************
   \brief
-	Unloads all assets and memory allocated for Heart Objects.
+	Loads all assets required for the creation and the picking up of
+	collectables, and creates the pool. Called once at the load function of
+	each level.
 *******************************************************************************/
-void heart_unload()
+void collectables_load()
 {
-	AEGfxMeshFree(pMeshHeart);
-	AEGfxTextureUnload(pTexHeart);
-	delete Heart::pick_up_sound;
-	delete pSpriteHeart;
+	pMeshCollectable = create_square_mesh(1.0f, 1.0f);
+	AE_ASSERT_MESG(pMeshCollectable, "Failed to create collectable mesh!");
+	for (int i{ 0 }; i < static_cast<int>(COLLECTABLE_TYPE::TOTAL); ++i)
+	{
+		const Collectable_Desc& desc = collectable_descs[i];
+		collectable_textures[i] = AEGfxTextureLoad(desc.texture);
+		AE_ASSERT_MESG(collectable_textures[i], "Failed to create collectable texture!");
+		collectable_sprites[i] = new Sprite(collectable_textures[i], pMeshCollectable, desc.scale);
+		pick_up_sounds[i] = new Audio(desc.pick_up_sound, AUDIO_GROUP::SFX);
+	}
+
+	v_pool_collectables.reserve(COLLECTABLE_CAPACITY);
+	v_pool_used.assign(COLLECTABLE_CAPACITY, false);
+	v_pool_free.resize(COLLECTABLE_CAPACITY);
+	v_pool_older.assign(COLLECTABLE_CAPACITY, NO_COLLECTABLE);
+	v_pool_newer.assign(COLLECTABLE_CAPACITY, NO_COLLECTABLE);
+	pool_oldest = pool_newest = NO_COLLECTABLE;
+	for (u32 i{ 0 }; i < COLLECTABLE_CAPACITY; ++i)
+	{
+		v_pool_collectables.emplace_back(transform_store_claim());
+		(Level::v_gameObjects).push_back(&v_pool_collectables[i]);
+		// The first collectable is at the back, so it is spawned first
+		v_pool_free[i] = COLLECTABLE_CAPACITY - 1 - i;
+	}
+	pool_stats = { COLLECTABLE_CAPACITY, 0, 0, 0 };
 }
 
 /*!*****************************************************************************
   \brief
-	Function to handle collision between Heart objects and platforms
+	Unloads all assets and memory allocated for collectables, and takes the
+	pool out of the vector of game objects before the level deletes the rest.
+*******************************************************************************/
+void collectables_unload()
+{
+	if (!v_pool_collectables.empty())
+	{
+		const Collectable* first = &v_pool_collectables.front();
+		const Collectable* last = &v_pool_collectables.back();
+		(Level::v_gameObjects).erase(std::remove_if((Level::v_gameObjects).begin(), (Level::v_gameObjects).end(),
+			[first, last](const gameObject* obj) { return obj >= first && obj <= last; }), (Level::v_gameObjects).end());
+	}
+	v_pool_collectables.clear();
+	v_pool_used.clear();
+	v_pool_free.clear();
+	v_pool_older.clear();
+	v_pool_newer.clear();
+	pool_oldest = pool_newest = NO_COLLECTABLE;
 
-  \param e_obj
-	a reference to a game object, assumed to be the heart game object itself.
+	for (int i{ 0 }; i < static_cast<int>(COLLECTABLE_TYPE::TOTAL); ++i)
+	{
+		AEGfxTextureUnload(collectable_textures[i]);
+		delete collectable_sprites[i];
+		delete pick_up_sounds[i];
+		collectable_textures[i] = nullptr;
+		collectable_sprites[i] = nullptr;
+		pick_up_sounds[i] = nullptr;
+	}
+	AEGfxMeshFree(pMeshCollectable);
+}
+
+/*!*****************************************************************************
+  \brief
+	Adds a collectable of the pool to the newest end of the list of
+	collectables in use.
 
-  \param obj
-	a reference to a game object, assumed to be the platform that the heart is
-	colliding with
+  \param index
+	The index of the collectable in the pool
 *******************************************************************************/
-void adjust_heart_movement(gameObject& e_obj, const gameObject& obj)
+static void link_collectable(u32 index)
 {
-	Heart* heart = dynamic_cast<Heart*>(&e_obj);
+	v_pool_older[index] = pool_newest;
+	v_pool_newer[index] = NO_COLLECTABLE;
+	if (pool_newest != NO_COLLECTABLE)
+		v_pool_newer[pool_newest] = index;
+	else
+		pool_oldest = index;
+	pool_newest = index;
+}
 
-	f32 heart_hw = (heart->bounding_box.max.x - heart->bounding_box.min.x) / 2;
-	f32 heart_hh = (heart->bounding_box.max.y - heart->bounding_box.min.y) / 2;
-	f32 obj_halfscale_x = (obj.bounding_box.max.x - obj.bounding_box.min.x) / 2;
-	f32 obj_halfscale_y = (obj.bounding_box.max.y - obj.bounding_box.min.y) / 2;
+/*!*****************************************************************************
+  \brief
+	Takes a collectable of the pool out of the list of collectables in use.
 
-	AEVec2 boss_middle{ heart->bounding_box.min.x + heart_hw, heart->bounding_box.min.y + heart_hh };
+  \param index
+	The index of the collectable in the pool
+*******************************************************************************/
+static void unlink_collectable(u32 index)
+{
+	if (v_pool_older[index] != NO_COLLECTABLE)
+		v_pool_newer[v_pool_older[index]] = v_pool_newer[index];
+	else
+		pool_oldest = v_pool_newer[index];
+	if (v_pool_newer[index] != NO_COLLECTABLE)
+		v_pool_older[v_pool_newer[index]] = v_pool_older[index];
+	else
+		pool_newest = v_pool_older[index];
+	v_pool_older[index] = v_pool_newer[index] = NO_COLLECTABLE;
+}
 
-	AEVec2 diff_pos = { obj.bounding_box.min.x + obj_halfscale_x, obj.bounding_box.min.y + obj_halfscale_y };
-	AEVec2Sub(&diff_pos, &boss_middle, &diff_pos);
+/*!*****************************************************************************
+  \brief
+	Spawns a collectable from the pool. If every collectable is in use, the
+	oldest one is taken in its place.
 
-	f32 min_distx = heart_hw + obj_halfscale_x;
-	f32 min_disty = heart_hh + obj_halfscale_y;
+  \param collectable_type
+	The type of the collectable
 
-	f32 depth_x = min_distx - fabs(diff_pos.x);
+  \param pos
+	The position to spawn the collectable at
 
-	f32 depth_y = min_disty - fabs(diff_pos.y);
-	if (depth_x != 0 && depth_y != 0)
+  \return
+	The collectable, or nullptr if the pool has not been created.
+*******************************************************************************/
+Collectable* spawn_collectable(COLLECTABLE_TYPE collectable_type, AEVec2 pos)
+{
+	u32 index;
+	if (!v_pool_free.empty())
 	{
-		if (fabs(depth_x) < fabs(depth_y))
-		{
-			heart->curr_pos.x += diff_pos.x < 0 ? -depth_x : depth_x;
-		}
-		else
-		{
-			heart->curr_pos.y += diff_pos.y < 0 ? -depth_y : depth_y;
-			heart->curr_vel.y = 0;
-
-			if (diff_pos.y > 0)
-			{
-				heart->on_ground = true;
-			}
-		}
+		index = v_pool_free.back();
+		v_pool_free.pop_back();
+		v_pool_used[index] = true;
+		pool_stats.in_use++;
+		pool_stats.peak = AEMax(pool_stats.peak, pool_stats.in_use);
 	}
+	else if (pool_oldest != NO_COLLECTABLE)
+	{
+		index = pool_oldest;
+		unlink_collectable(index);
+		pool_stats.reused++;
+	}
+	else
+		return nullptr;
+	link_collectable(index);
+
+	// Reset the collectable as if it was newly created, which also gives it a new id
+	Collectable& collectable = v_pool_collectables[index];
+	collectable = Collectable(collectable_type, pos);
+	return &collectable;
 }
 
 /*!*****************************************************************************
   \brief
-	Function to handle collision of hearts with other game objects. Checks
-	through all objects the heart is currently colliding with, and calls the
-	appropriate function to handle each collision.
+	Switches off a collectable and returns it to the pool.
 
-  \param obj
-	a reference to a game object, assumed to be the heart game object itself.
+  \param collectable
+	The collectable to be released
 *******************************************************************************/
-void collectables_collide(gameObject& obj)
+void release_collectable(Collectable* collectable)
 {
-	Heart* heart = dynamic_cast<Heart*>(&obj);
-	vector<gameObject*>& colliders = obj.colliders;
-	for (vector<gameObject*>::iterator i = colliders.begin(); i != colliders.end(); ++i)
-	{
-		gameObject& obj_col = **i;
-		if (obj_col.type == GO_TYPE::GO_PLATFORM)
-		{
-			adjust_heart_movement(obj, obj_col);
-		}
-	}
+	if (!collectable || v_pool_collectables.empty() ||
+		collectable < &v_pool_collectables.front() || collectable > &v_pool_collectables.back())
+		return;
+	u32 index = static_cast<u32>(collectable - &v_pool_collectables.front());
+	collectable->flag = false;
+	if (!v_pool_used[index])
+		return;
+	v_pool_used[index] = false;
+	unlink_collectable(index);
+	v_pool_free.push_back(index);
+	pool_stats.in_use--;
 }
 
 /*!*****************************************************************************
   \brief
-	Function to spawn a heart object randomly.
+	Plays the pick up sound of a collectable and returns it to the pool. The
+	effect of the collectable is applied by whoever picked it up.
+
+  \param collectable
+	The collectable being picked up
+*******************************************************************************/
+void collectable_pick_up(Collectable& collectable)
+{
+	pick_up_sounds[static_cast<int>(collectable.collectable_type)]->play_sound();
+	release_collectable(&collectable);
+}
+
+/*!*****************************************************************************
+  \brief
+	Rolls the drop chance of each type of collectable, and spawns the first
+	one that succeeds.
 
   \param enemy
 	a reference to a game object, assumed to be the enemy who was just killed
 	by the player.
 *******************************************************************************/
-void spawn_heart(gameObject& enemy)
+void spawn_drop(gameObject& enemy)
 {
-	if (AERandFloat() > 0.8f)
+	for (int i{ 0 }; i < static_cast<int>(COLLECTABLE_TYPE::TOTAL); ++i)
 	{
-		Heart* pHeart = new Heart();
-		pHeart->game_object_initialize();
-		pHeart->curr_pos = enemy.curr_pos;
-		Level::v_gameObjects.push_back(pHeart);
+		if (AERandFloat() < collectable_descs[i].drop_chance)
+		{
+			spawn_collectable(static_cast<COLLECTABLE_TYPE>(i), enemy.curr_pos);
+			return;
+		}
 	}
-}
\ No newline at end of file
+}
+
+/*!*****************************************************************************
+  \brief
+	Gets the usage of the collectable pool
+
+  \return
+	The capacity, current and peak usage of the pool, and how many drops
+	replaced the oldest collectable because it was full.
+*******************************************************************************/
+Collectable_Stats get_collectable_stats()
+{
+	return pool_stats;
+}
@@ -11,7 +11,15 @@ This file contains the implementation of the collision system in the game
 
 The functions include:
 - rtr_collide
+- rtr_contact
+- rtr_sweep
+- sweep_fast_objects
+- AABB_Batch::clear
+- AABB_Batch::push_back
+- AABB_Batch::size
+- rtr_collide_batch
 - collision_update
+- collision_benchmark
 
 Copyright (C) 2021 DigiPen Institure of Technology.
 Reproduction or disclosure of this file or its contents
@@ -20,7 +28,16 @@ Technology is prohibited.
 ****************************************************************************
 ***/
 #include "main.h"
+#include <cfloat>
+#include <emmintrin.h>
 #include "gameobject.h"
+#include "broadphase.h"
+#include "contact.h"
+#include "kinematic.h"
+#include "mem_tracker.h"
+
+// How far a swept object is left inside what it hit, so that it still collides
+constexpr f32 SWEEP_SKIN = 0.01f;
 
 /**
  * @brief AABB collision checking between 2 rectangles
@@ -107,35 +124,334 @@ bool rtr_collide(const AABB& aabb1, const AEVec2& vel1,
 	return 1;
 }
 
+/**
+ * @brief Gets how the first rectangle touches the second. The depth is
+ * measured between the centres of the rectangles, so it stays valid for the
+ * whole frame even after either object is moved.
+ *
+ * @param aabb1
+ * LHS AABB
+ * @param aabb2
+ * RHS AABB
+ * @param time
+ * Fraction of the frame at which the rectangles met
+ * @return Contact
+ * Contact seen from the LHS
+ */
+Contact rtr_contact(const AABB& aabb1, const AABB& aabb2, f32 time)
+{
+	Contact contact;
+	f32 hw1 = (aabb1.max.x - aabb1.min.x) / 2;
+	f32 hh1 = (aabb1.max.y - aabb1.min.y) / 2;
+	f32 hw2 = (aabb2.max.x - aabb2.min.x) / 2;
+	f32 hh2 = (aabb2.max.y - aabb2.min.y) / 2;
+
+	AEVec2 middle1{ aabb1.min.x + hw1, aabb1.min.y + hh1 };
+	contact.offset = { aabb2.min.x + hw2, aabb2.min.y + hh2 };
+	AEVec2Sub(&contact.offset, &middle1, &contact.offset);
+	contact.depth.x = hw1 + hw2 - fabs(contact.offset.x);
+	contact.depth.y = hh1 + hh2 - fabs(contact.offset.y);
+	if (fabs(contact.depth.x) < fabs(contact.depth.y))
+		contact.normal = { contact.offset.x < 0 ? -1.0f : 1.0f, 0.0f };
+	else
+		contact.normal = { 0.0f, contact.offset.y < 0 ? -1.0f : 1.0f };
+	contact.time = time;
+	return contact;
+}
+
+/**
+ * @brief Swept AABB collision checking between 2 rectangles. Finds if the
+ * rectangles met during the frame while they were apart at its start, even
+ * if they no longer overlap at its end.
+ *
+ * @param aabb1
+ * LHS AABB at the end of the frame
+ * @param disp1
+ * Distance moved by the LHS this frame
+ * @param aabb2
+ * RHS AABB at the end of the frame
+ * @param disp2
+ * Distance moved by the RHS this frame
+ * @param time
+ * Fraction of the frame at which the rectangles met
+ * @param axis
+ * 0 if the rectangles met along x, 1 if they met along y
+ * @return true
+ * The rectangles met during the frame
+ * @return false
+ * The rectangles did not meet, or were already overlapping
+ */
+bool rtr_sweep(const AABB& aabb1, const AEVec2& disp1,
+	const AABB& aabb2, const AEVec2& disp2, f32& time, u32& axis)
+{
+	// Move the LHS relative to the RHS, starting from where both began the frame
+	f32 vel[2]{ disp1.x - disp2.x, disp1.y - disp2.y };
+	f32 min1[2]{ aabb1.min.x - disp1.x, aabb1.min.y - disp1.y };
+	f32 max1[2]{ aabb1.max.x - disp1.x, aabb1.max.y - disp1.y };
+	f32 min2[2]{ aabb2.min.x - disp2.x, aabb2.min.y - disp2.y };
+	f32 max2[2]{ aabb2.max.x - disp2.x, aabb2.max.y - disp2.y };
+
+	f32 tFirst = -FLT_MAX, tLast = FLT_MAX;
+	axis = 0;
+	for (u32 i{ 0 }; i < 2; ++i)
+	{
+		if (vel[i] == 0)
+		{
+			if (max1[i] < min2[i] || min1[i] > max2[i])
+				return false;
+			continue;
+		}
+		f32 t1 = (min2[i] - max1[i]) / vel[i];
+		f32 t2 = (max2[i] - min1[i]) / vel[i];
+		if (AEMin(t1, t2) > tFirst)
+		{
+			tFirst = AEMin(t1, t2);
+			axis = i;
+		}
+		tLast = AEMin(AEMax(t1, t2), tLast);
+	}
+	if (!(tFirst <= tLast && tFirst > 0 && tFirst <= 1))
+		return false;
+	time = tFirst;
+	return true;
+}
+
+/**
+ * @brief Removes all bounding boxes from the batch
+ *
+ */
+void AABB_Batch::clear()
+{
+	min_x.clear();
+	min_y.clear();
+	max_x.clear();
+	max_y.clear();
+}
+
+/**
+ * @brief Adds a bounding box to the end of the batch
+ *
+ * @param aabb
+ * Bounding box to add
+ */
+void AABB_Batch::push_back(const AABB& aabb)
+{
+	min_x.push_back(aabb.min.x);
+	min_y.push_back(aabb.min.y);
+	max_x.push_back(aabb.max.x);
+	max_y.push_back(aabb.max.y);
+}
+
+/**
+ * @brief Gets the number of bounding boxes in the batch
+ *
+ * @return u32
+ * Number of bounding boxes
+ */
+u32 AABB_Batch::size() const
+{
+	return static_cast<u32>(min_x.size());
+}
+
+/**
+ * @brief AABB collision checking between one rectangle and a batch of
+ * rectangles, 4 at a time.
+ * Gives the same result as rtr_collide for each rectangle. Once the boxes
+ * pass the separation test in rtr_collide, the relative velocity can only
+ * push tLast up and never moves tFirst off 0, so the velocities do not
+ * change the result and are not needed here.
+ *
+ * @param aabb
+ * LHS AABB
+ * @param batch
+ * RHS AABBs
+ * @param hits
+ * Bit i of hits[i / 32] is set if aabb collides with box i of the batch
+ */
+void rtr_collide_batch(const AABB& aabb, const AABB_Batch& batch, vector<u32>& hits)
+{
+	u32 count = batch.size();
+	hits.assign((count + 31) / 32, 0);
+
+	__m128 a_min_x = _mm_set1_ps(aabb.min.x);
+	__m128 a_min_y = _mm_set1_ps(aabb.min.y);
+	__m128 a_max_x = _mm_set1_ps(aabb.max.x);
+	__m128 a_max_y = _mm_set1_ps(aabb.max.y);
+	u32 i{ 0 };
+	for (; i + 4 <= count; i += 4)
+	{
+		// Same separation test as rtr_collide, NaN compares as not separated
+		__m128 separated = _mm_or_ps(
+			_mm_or_ps(_mm_cmplt_ps(a_max_x, _mm_loadu_ps(&batch.min_x[i])),
+				_mm_cmplt_ps(a_max_y, _mm_loadu_ps(&batch.min_y[i]))),
+			_mm_or_ps(_mm_cmpgt_ps(a_min_x, _mm_loadu_ps(&batch.max_x[i])),
+				_mm_cmpgt_ps(a_min_y, _mm_loadu_ps(&batch.max_y[i]))));
+		u32 mask = static_cast<u32>(~_mm_movemask_ps(separated)) & 0xF;
+		hits[i / 32] |= mask << (i % 32);
+	}
+	for (; i < count; ++i)
+	{
+		if (!((aabb.max.x < batch.min_x[i] || aabb.max.y < batch.min_y[i]) ||
+			(aabb.min.x > batch.max_x[i] || aabb.min.y > batch.max_y[i])))
+			hits[i / 32] |= 1u << (i % 32);
+	}
+}
+
+/**
+ * @brief Moves fast objects back to where they first touched a platform or a
+ * wall this frame. Otherwise an object moving further than its own size in a
+ * frame could pass through a thin platform or wall without ever overlapping it.
+ * Every fast object is swept, even if its type never collides with terrain,
+ * and is only moved back once, to the first platform or wall it reached.
+ *
+ * @param v_obj
+ * Vector of game objects
+ * @param impacts
+ * Output vector of the pairs that were swept, with their time of impact
+ */
+static void sweep_fast_objects(vector<gameObject*>& v_obj, vector<std::pair<u64, f32>>& impacts)
+{
+	static vector<u32> v_terrain;
+	impacts.clear();
+	for (u32 i{ 0 }; i < v_obj.size(); ++i)
+	{
+		gameObject* obj = v_obj[i];
+		AEVec2 disp, zero{ 0, 0 };
+		if (!obj->flag || obj->is_asleep || !get_sweep(*obj, disp))
+			continue;
+
+		broadphase_find_terrain(v_obj, get_swept_aabb(*obj), v_terrain);
+		u32 first{ 0 }, axis{ 0 };
+		f32 time{ FLT_MAX };
+		for (u32 index : v_terrain)
+		{
+			const gameObject* terrain = v_obj[index];
+			f32 terrain_time;
+			u32 terrain_axis;
+			// Terrain it ends the frame in is left to the narrowphase
+			if (rtr_collide(obj->bounding_box, obj->curr_vel, terrain->bounding_box, terrain->curr_vel) ||
+				!rtr_sweep(obj->bounding_box, disp, terrain->bounding_box, zero, terrain_time, terrain_axis) ||
+				terrain_time >= time)
+				continue;
+			first = index;
+			time = terrain_time;
+			axis = terrain_axis;
+		}
+		if (time == FLT_MAX)
+			continue;
+		const gameObject* terrain = v_obj[first];
+
+		// Stop where the object first touched, just inside so that it still collides
+		AEVec2 back;
+		AEVec2Scale(&back, &disp, time - 1.0f);
+		AEVec2Add(&obj->curr_pos, &obj->curr_pos, &back);
+		obj->set_aabb();
+		f32 skin = SWEEP_SKIN;
+		if (axis == 0)
+		{
+			f32 gap = disp.x > 0 ? terrain->bounding_box.min.x - obj->bounding_box.max.x : obj->bounding_box.min.x - terrain->bounding_box.max.x;
+			obj->curr_pos.x += (disp.x > 0 ? 1.0f : -1.0f) * (gap + skin);
+		}
+		else
+		{
+			f32 gap = disp.y > 0 ? terrain->bounding_box.min.y - obj->bounding_box.max.y : obj->bounding_box.min.y - terrain->bounding_box.max.y;
+			obj->curr_pos.y += (disp.y > 0 ? 1.0f : -1.0f) * (gap + skin);
+		}
+		obj->set_aabb();
+		impacts.push_back({ i < first ? (static_cast<u64>(i) << 32) | first : (static_cast<u64>(first) << 32) | i, time });
+	}
+}
+
 /**
  * @brief Performs collision checking in the vector of game object
  * No collision check is done if both game objects are static and if one of their flag is false
- * Checks for collision between all game objects. If they are colliding, a reference will
- * be added to the vector of colliders for each game object.
+ * Pairs of types that no on_collide function reads are skipped, see GO_COLLISION_MASK.
+ * Candidate pairs are found by the broadphase and then checked for collision,
+ * with all the pairs of an object checked in one rtr_collide_batch.
+ * Fast objects are first moved back to the platform or wall they passed
+ * through this frame. Sleeping objects that collide with an awake object are
+ * woken up, while the ones only sharing a grid cell keep sleeping.
+ * If they are colliding, a reference will be added to the vector of colliders
+ * for each game object, along with the contact in the vector of contacts. The candidate pairs are sorted by index so the
+ * colliders are filled in the same order as checking all pairs would.
  *
- * Iterate once again to call the on_collide functions of the game object if there is collision.
+ * Bodies are then pushed out of platforms and walls in a single pass by
+ * resolve_bodies, so the on_collide functions only react to on_ground.
+ * Iterate once again to call the on_collide functions of the game object if there is collision,
+ * skipping objects switched off by an earlier on_collide function such as a released attack collider.
  * Clear the colliders afterwards.
  *
+ * The colliders and contacts are small vectors, and the contact cache reuses
+ * its memory, so the collision system itself stops allocating once every
+ * list has grown to what the level needs. The attack handlers called by the
+ * on_collide functions check the contact cache with contact_first_hit, so an
+ * attack only hits each target once. With MEM_TRACKING the collision stats
+ * count every allocation made during the update, including the ones made by
+ * on_collide functions. Without it they only count the growth of the
+ * colliders, contacts and contact cache.
+ *
  * @param v_obj
  */
 void collision_update(vector<gameObject*>& v_obj)
 {
-	for (std::vector<gameObject*>::iterator i = v_obj.begin(); i != v_obj.end(); ++i)
+	static vector<u64> pairs;
+	static AABB_Batch batch;
+	static vector<u32> hits;
+	static vector<std::pair<u64, f32>> impacts;
+	Collision_Stats& stats = get_collision_stats();
+	f64 start, end;
+	AEGetTime(&start);
+#ifdef MEM_TRACKING
+	u32 allocations = get_mem_allocation_count();
+#else
+	u32 allocations = get_small_vector_stats().allocations + get_contact_allocations();
+#endif
+	broadphase_find_pairs(v_obj, pairs);
+	sweep_fast_objects(v_obj, impacts);
+	stats.pairs_tested = static_cast<u32>(pairs.size());
+	stats.pairs_hit = 0;
+	for (size_t begin{ 0 }; begin < pairs.size();)
 	{
-		for (std::vector<gameObject*>::iterator j = i + 1; j != v_obj.end(); j++)
+		// Every pair of an object is tested at once
+		u32 first = static_cast<u32>(pairs[begin] >> 32);
+		size_t end = begin + 1;
+		while (end < pairs.size() && static_cast<u32>(pairs[end] >> 32) == first)
+			++end;
+
+		gameObject* a = v_obj[first];
+		batch.clear();
+		for (size_t i{ begin }; i < end; ++i)
+			batch.push_back(v_obj[static_cast<u32>(pairs[i])]->bounding_box);
+		rtr_collide_batch(a->bounding_box, batch, hits);
+
+		for (size_t i{ begin }; i < end; ++i)
 		{
-			gameObject* a = *i;
-			gameObject* b = *j;
-			if ((!a->is_static || !b->is_static) && (a->flag && b->flag) &&
-				rtr_collide(a->bounding_box, a->curr_vel, b->bounding_box, b->curr_vel))
+			u32 bit = static_cast<u32>(i - begin);
+			if (!(hits[bit / 32] & (1u << (bit % 32))))
+				continue;
+			gameObject* b = v_obj[static_cast<u32>(pairs[i])];
+			f32 time{ 0.0f };
+			for (const std::pair<u64, f32>& impact : impacts)
 			{
-				a->is_colliding = true;
-				b->is_colliding = true;
-				a->colliders.push_back(b);
-				b->colliders.push_back(a);
+				if (impact.first == pairs[i])
+					time = impact.second;
 			}
+			// A sleeping object touched by an awake object wakes up
+			if (a->is_asleep)
+				wake_object(a);
+			if (b->is_asleep)
+				wake_object(b);
+			a->is_colliding = true;
+			b->is_colliding = true;
+			a->colliders.push_back(b);
+			b->colliders.push_back(a);
+			a->contacts.push_back(rtr_contact(a->bounding_box, b->bounding_box, time));
+			b->contacts.push_back(rtr_contact(b->bounding_box, a->bounding_box, time));
+			++stats.pairs_hit;
 		}
+		begin = end;
 	}
+	resolve_bodies(v_obj);
 
 	for (size_t i{ 0 }; i < v_obj.size(); i++)
 	{
@@ -147,10 +463,78 @@ void collision_update(vector<gameObject*>& v_obj)
 		}
 		else
 		{
-			if (!obj->colliders.empty() && obj->on_collide != nullptr)
+			if (obj->flag && !obj->colliders.empty() && obj->on_collide != nullptr)
 				obj->on_collide(*obj);
 		}
 		obj->colliders.clear();
+		obj->contacts.clear();
 		obj->is_colliding = false;
 	}
-}
\ No newline at end of file
+#ifdef MEM_TRACKING
+	stats.allocations = get_mem_allocation_count() - allocations;
+#else
+	stats.allocations = get_small_vector_stats().allocations + get_contact_allocations() - allocations;
+#endif
+	AEGetTime(&end);
+	stats.time = end - start;
+}
+
+#if defined(DEBUG) | defined(_DEBUG)
+/**
+ * @brief Times rtr_collide against rtr_collide_batch on random boxes, testing
+ * one box against all the others the way an attack collider is tested
+ * against the enemies of an area.
+ *
+ * @param boxes
+ * Number of boxes to test against
+ * @param iterations
+ * Number of times each path is run
+ * @return Collision_Benchmark
+ * Time taken by each path and whether their results agree
+ */
+Collision_Benchmark collision_benchmark(u32 boxes, u32 iterations)
+{
+	vector<AABB> v_aabb;
+	vector<AEVec2> v_vel;
+	AABB_Batch batch;
+	for (u32 i{ 0 }; i < boxes + 1; ++i)
+	{
+		AEVec2 pos{ AERandFloat() * 2560.0f, AERandFloat() * 720.0f };
+		AEVec2 half{ 10.0f + AERandFloat() * 100.0f, 10.0f + AERandFloat() * 100.0f };
+		AABB aabb{ { pos.x - half.x, pos.y - half.y }, { pos.x + half.x, pos.y + half.y } };
+		v_aabb.push_back(aabb);
+		v_vel.push_back({ AERandFloat() * 1000.0f - 500.0f, AERandFloat() * 1000.0f - 500.0f });
+		if (i)
+			batch.push_back(aabb);
+	}
+
+	vector<u32> scalar_hits((boxes + 31) / 32, 0);
+	vector<u32> batch_hits;
+	Collision_Benchmark result{ boxes, iterations, 0.0, 0.0, true };
+	f64 start, end;
+
+	AEGetTime(&start);
+	for (u32 n{ 0 }; n < iterations; ++n)
+	{
+		std::fill(scalar_hits.begin(), scalar_hits.end(), 0);
+		for (u32 i{ 0 }; i < boxes; ++i)
+		{
+			if (rtr_collide(v_aabb[0], v_vel[0], v_aabb[i + 1], v_vel[i + 1]))
+				scalar_hits[i / 32] |= 1u << (i % 32);
+		}
+	}
+	AEGetTime(&end);
+	result.scalar_time = end - start;
+
+	AEGetTime(&start);
+	for (u32 n{ 0 }; n < iterations; ++n)
+	{
+		rtr_collide_batch(v_aabb[0], batch, batch_hits);
+	}
+	AEGetTime(&end);
+	result.batch_time = end - start;
+
+	result.results_match = scalar_hits == batch_hits;
+	return result;
+}
+#endif
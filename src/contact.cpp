@@ -0,0 +1,258 @@
+/*!*************************************************************************
+****
+\file   contact.cpp
+\author agent
+\par    email: agent\@local
+\date   Oct 17 2026
+
+\brief
+This file contains the implementation of the contact cache of the collision
+system in the game engine.
+
+Hits are keyed by the id of the target and the source rather than their
+address, so an object that is deleted and replaced by a new one at the same
+address is never mistaken for the old one. They are kept in an open
+addressing hash table with linear probing, so checking a hit does not depend
+on how many hits there are.
+
+Nothing is erased from the table as it is used. Hits of an old generation
+can never match again, and neither can the hits of a released attack
+collider since it comes back with a new id, so both are only dropped when
+the table is rebuilt once it is half full. The table only grows if it is
+still half full after that, so once it has grown to what the level needs no
+more memory is allocated.
+
+The functions include:
+- make_hit_key
+- find_hit
+- is_stale
+- rebuild_hits
+- contact_first_hit
+- contact_next_generation
+- get_contact_generation
+- contact_forget
+- contact_clear
+- get_contact_allocations
+
+Copyright (C) 2026 DigiPen Institure of Technology.
+Reproduction or disclosure of this file or its contents
+without the prior written consent of DigiPen Institute of
+Technology is prohibited.
+****************************************************************************
+***/
+#include "main.h"
+#include <algorithm>
+#include "contact.h"
+
+// Generation of the attack in which the source last hit the target
+struct Hit
+{
+	u64 key;		// ids of the target and the source, EMPTY_HIT if the entry is unused
+	u32 generation;
+};
+constexpr u64 EMPTY_HIT = ~0ull;
+// Starting size of the table, enough for every attack collider to hit every enemy on screen
+static const size_t HIT_CAPACITY = 256;
+// Hash table with a power of two size, and the table it is rebuilt into
+static vector<Hit> hits;
+static vector<Hit> rebuilt_hits;
+static size_t hit_count = 0;
+static u32 hit_shift = 64;
+static u32 hit_generation = 1;
+// Ids of the objects forgotten since the table was last rebuilt, sorted while rebuilding
+static vector<u32> forgotten;
+// Times the hit table had to allocate a larger buffer
+static u32 contact_allocations = 0;
+
+/*!****************************************************************************
+ * @brief Packs the ids of a target and the source hitting it into a key
+ *
+ * @param target
+ * Game object being hit
+ * @param source
+ * Game object hitting the target
+ * @return u64
+ * Hit key
+******************************************************************************/
+static inline u64 make_hit_key(const gameObject& target, const gameObject& source)
+{
+	return (static_cast<u64>(target.id) << 32) | source.id;
+}
+
+/*!****************************************************************************
+ * @brief Finds the entry of a key in a table, or the unused entry it would be
+ * added at
+ *
+ * @param table
+ * Hash table of hits, with a size of 2 to the power of 64 - hit_shift
+ * @param key
+ * Hit key
+ * @return Hit&
+ * Entry with the key, or an unused entry
+******************************************************************************/
+static Hit& find_hit(vector<Hit>& table, u64 key)
+{
+	const size_t mask = table.size() - 1;
+	size_t slot = static_cast<size_t>((key * 0x9E3779B97F4A7C15ull) >> hit_shift);
+	while (table[slot].key != key && table[slot].key != EMPTY_HIT)
+		slot = (slot + 1) & mask;
+	return table[slot];
+}
+
+/*!****************************************************************************
+ * @brief Checks if a hit can never match again
+ *
+ * @param hit
+ * Hit in the table
+ * @return true
+ * The hit is of an old generation, or of a forgotten game object
+ * @return false
+ * The hit is still needed
+******************************************************************************/
+static bool is_stale(const Hit& hit)
+{
+	if (hit.generation != 0 && hit.generation != hit_generation)
+		return true;
+	return std::binary_search(forgotten.begin(), forgotten.end(), static_cast<u32>(hit.key >> 32)) ||
+		std::binary_search(forgotten.begin(), forgotten.end(), static_cast<u32>(hit.key));
+}
+
+/*!****************************************************************************
+ * @brief Rebuilds the table without its stale hits
+ *
+ * @param capacity
+ * Size of the rebuilt table, a power of two
+******************************************************************************/
+static void rebuild_hits(size_t capacity)
+{
+	std::sort(forgotten.begin(), forgotten.end());
+	if (rebuilt_hits.capacity() < capacity)
+		++contact_allocations;
+	rebuilt_hits.assign(capacity, Hit{ EMPTY_HIT, 0 });
+	hit_shift = 64;
+	for (size_t size{ 1 }; size < capacity; size <<= 1)
+		--hit_shift;
+
+	hit_count = 0;
+	for (const Hit& hit : hits)
+	{
+		if (hit.key == EMPTY_HIT || is_stale(hit))
+			continue;
+		find_hit(rebuilt_hits, hit.key) = hit;
+		++hit_count;
+	}
+	hits.swap(rebuilt_hits);
+	forgotten.clear();
+	if (forgotten.capacity() < capacity / 2)
+	{
+		forgotten.reserve(capacity / 2);
+		++contact_allocations;
+	}
+}
+
+/*!****************************************************************************
+ * @brief Checks if this is the first time the source hits the target in the
+ * generation, and remembers the hit. The hit is directed, so the target and
+ * the source can each keep track of their hits on the other.
+ *
+ * @param target
+ * Game object being hit
+ * @param source
+ * Game object hitting the target
+ * @param generation
+ * Generation of the hit. Hits of the default generation are kept until
+ * contact_forget is called on either game object
+ * @return true
+ * First hit of the source on the target in the generation
+ * @return false
+ * The source already hit the target in the generation
+******************************************************************************/
+bool contact_first_hit(const gameObject& target, const gameObject& source, u32 generation)
+{
+	if (hits.empty())
+		rebuild_hits(HIT_CAPACITY);
+
+	const u64 key = make_hit_key(target, source);
+	Hit* hit = &find_hit(hits, key);
+	if (hit->key == key)
+	{
+		if (hit->generation == generation)
+			return false;
+		hit->generation = generation;
+		return true;
+	}
+
+	// Keep the table at most half full, growing it only if dropping the stale hits is not enough
+	if ((hit_count + 1) * 2 > hits.size())
+	{
+		rebuild_hits(hits.size());
+		if ((hit_count + 1) * 2 > hits.size())
+			rebuild_hits(hits.size() * 2);
+		hit = &find_hit(hits, key);
+	}
+	*hit = Hit{ key, generation };
+	++hit_count;
+	return true;
+}
+
+/*!****************************************************************************
+ * @brief Starts a new generation of hits. Called when the player starts a new
+ * attack, so that every enemy can be hit again.
+ *
+******************************************************************************/
+void contact_next_generation()
+{
+	// Generation 0 is for hits that are never forgotten
+	if (++hit_generation == 0)
+		++hit_generation;
+}
+
+/*!****************************************************************************
+ * @brief Gets the current generation of hits
+ *
+ * @return u32
+ * Current generation
+******************************************************************************/
+u32 get_contact_generation()
+{
+	return hit_generation;
+}
+
+/*!****************************************************************************
+ * @brief Forgets every hit of or on a game object. Called when an attack
+ * collider is released, since it comes back with a new id. The hits are
+ * dropped the next time the table is rebuilt.
+ *
+ * @param obj
+ * Game object to forget
+******************************************************************************/
+void contact_forget(const gameObject& obj)
+{
+	if (!hit_count)
+		return;
+	forgotten.push_back(obj.id);
+	if (forgotten.size() == forgotten.capacity())
+		rebuild_hits(hits.size());
+}
+
+/*!****************************************************************************
+ * @brief Removes every hit. Called when the level unloads.
+ *
+******************************************************************************/
+void contact_clear()
+{
+	std::fill(hits.begin(), hits.end(), Hit{ EMPTY_HIT, 0 });
+	hit_count = 0;
+	forgotten.clear();
+}
+
+/*!****************************************************************************
+ * @brief Gets how many times the contact cache allocated memory for its hits
+ *
+ * @return u32
+ * Number of allocations since the game started
+******************************************************************************/
+u32 get_contact_allocations()
+{
+	return contact_allocations;
+}
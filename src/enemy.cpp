@@ -42,6 +42,7 @@ Technology is prohibited.
 #include "collectables.h"
 #include "particlesystem.h"
 #include "level_manager.h"
+#include "contact.h"
 
 AEVec2 enemy_pos;
 AEVec2 enemy_size;
@@ -63,7 +64,7 @@ static Color default_tint = { 1.0f, 1.0f, 1.0f, 1.0f };
 	Enemy default constructor: default enemy type is a slime.
 *******************************************************************************/
 Enemy::Enemy() : gameObject(), dmg(1), flinch(), innerBound(), invul_timer(), is_invul(), collider{ nullptr }, curr_attack(nullptr),
-cooldown_timer(), anim_state{ ENEMY_ANIM::DEFAULT }, debuff{}
+cooldown_timer(), anim_state{ ENEMY_ANIM::DEFAULT }, debuff{}, sprite_asset{ nullptr }, render_state{}
 {
 	full_health = ENEMY_HEALTH;
 	health = ENEMY_HEALTH;
@@ -97,14 +98,17 @@ void Enemy::swap(Enemy& rhs)
 	std::swap(health, rhs.health);
 	std::swap(obj_index, rhs.obj_index);
 	std::swap(spr_index, rhs.spr_index);
+	std::swap(sprite_asset, rhs.sprite_asset);
+	std::swap(render_state, rhs.render_state);
 }
 
 /*!*****************************************************************************
   \brief
 	Enemy copy constructor.
 *******************************************************************************/
-Enemy::Enemy(const Enemy& rhs) : cooldown_timer{ rhs.cooldown_timer }, full_health{ rhs.full_health }, flinch(), innerBound(), invul_timer(), is_invul(), collider{ nullptr }, curr_attack(nullptr),
-enemy_type(rhs.enemy_type), anim_state{ rhs.anim_state }, debuff{ rhs.debuff }
+Enemy::Enemy(const Enemy& rhs) : gameObject(rhs), cooldown_timer{ rhs.cooldown_timer }, full_health{ rhs.full_health }, flinch(), innerBound(), invul_timer(), is_invul(), collider{ nullptr }, curr_attack(nullptr),
+enemy_type(rhs.enemy_type), anim_state{ rhs.anim_state }, debuff{ rhs.debuff }, sprite_asset{ rhs.sprite_asset },
+render_state{ rhs.render_state }
 {
 	health = rhs.health;
 	obj_index = rhs.obj_index;
@@ -116,13 +120,13 @@ enemy_type(rhs.enemy_type), anim_state{ rhs.anim_state }, debuff{ rhs.debuff }
   \brief
 	Parameterized enemy constructor.
 *******************************************************************************/
-Enemy::Enemy(s32 health, AEVec2 init_pos, AEVec2 scale, Sprite* spr) : Enemy()
+Enemy::Enemy(s32 health, AEVec2 init_pos, AEVec2 scale, const Sprite_Asset* asset) : Enemy()
 {
 	this->health = health;
 	this->full_health = health;
 	this->init_pos = init_pos;
 	this->scale = scale;
-	this->obj_sprite = spr;
+	this->sprite_asset = asset;
 }
 
 /*!*****************************************************************************
@@ -155,12 +159,12 @@ void Enemy::behaviour(gameObject& gameObj)
 	{
 		if (gameObj.curr_pos.x > curr_pos.x && AEVec2Distance(&curr_pos, &Level::player->curr_pos) >= 50.0f) //if player pos is more than monster pos then
 		{
-			obj_sprite->flip_x = true;
+			render_state.flip_x = true;
 			acceleration.x += 100 * G_DELTATIME * FPS; //move right
 		}
 		else if (gameObj.curr_pos.x < curr_pos.x && AEVec2Distance(&curr_pos, &Level::player->curr_pos) >= 50.0f)
 		{
-			obj_sprite->flip_x = false;
+			render_state.flip_x = false;
 			acceleration.x += -100 * G_DELTATIME * FPS; // move left
 		}
 	}
@@ -238,8 +242,8 @@ void load_enemy_assets()
 *******************************************************************************/
 void Enemy::game_object_load()
 {
-	Animation slime_ani = Animation(3, { 0.0f, 0.0f }, obj_sprite, 205, 0.1f);
-	Animation melee_ani = Animation(4, { 00.0f, 0.0f }, obj_sprite, 302, 0.3f);
+	Animation slime_ani = Animation(3, { 0.0f, 0.0f }, &render_state, 205, 0.1f);
+	Animation melee_ani = Animation(4, { 00.0f, 0.0f }, &render_state, 302, 0.3f);
 	if (this->enemy_type == ENEMY_TYPE::ENEMY_SLIME)
 	{
 		animations.push_back(slime_ani);
@@ -257,7 +261,7 @@ void Enemy::game_object_load()
 void Enemy::game_object_initialize()
 {
 	curr_pos = init_pos;
-	collider = dynamic_cast<Attack_Collider*>(push_object(GO_TYPE::GO_ENEMYATTACKCOLLIDER, this));
+	collider = go_cast<Attack_Collider>(push_object(GO_TYPE::GO_ENEMYATTACKCOLLIDER, this));
 	enemy_attack_init(*this);
 }
 
@@ -279,10 +283,10 @@ void Enemy::game_object_update()
 		pSystem->direction_range[1] = 2.0f * PI;
 		pSystem->game_object_update();
 		Camera::shake(10, 0.1f);
-		flag = false;
+		destroy_object(this);
 		slime_death_sound->play_sound();
 		remove_attack_collider(this);
-		spawn_heart(*this);
+		spawn_drop(*this);
 	}
 	acceleration.y += LEVEL_GRAVITY;
 	AEVec2Add(&curr_vel, &curr_vel, &acceleration);
@@ -312,22 +316,13 @@ void Enemy::game_object_draw()
 		full_bar();
 		f_healths();
 	}
-	obj_sprite->tint = debuff.activated ? bleed_tint : default_tint;
+	render_state.tint = debuff.activated ? bleed_tint : default_tint;
 	if (this->enemy_type == ENEMY_TYPE::ENEMY_SLIME)
 	{
 		animations[0].play_animation();
 	}
-	draw(obj_sprite, curr_pos, scale);
-}
-
-/*!*****************************************************************************
-  \brief
-	This function frees all the assets used to implement the enemy.
-*******************************************************************************/
-void Enemy::game_object_free()
-{
-	ignorecolliders.clear();
-	ignorecolliders.~vector();
+	if (sprite_asset)
+		draw(*sprite_asset, render_state, curr_pos, scale);
 }
 
 /*!*****************************************************************************
@@ -353,51 +348,6 @@ void unload_enemy_assets()
 	delete slime_death_sound;
 }
 
-/*!*****************************************************************************
-  \brief
-	This function adjust the enemy movement for collision and checks for empty
-	platforms.
-*******************************************************************************/
-void adjust_enemy_movement(gameObject& e_obj, const gameObject& obj)
-{
-	Enemy* enemy = dynamic_cast<Enemy*>(&e_obj);
-	AEVec2 diff_pos = obj.curr_pos;
-	AEVec2Sub(&diff_pos, &enemy->curr_pos, &diff_pos);
-
-	f32 enemy_width = (enemy->innerBound.max.x - enemy->innerBound.min.x) / 2;
-	f32 enemy_hh = (enemy->innerBound.max.y - enemy->innerBound.min.y) / 2;
-	f32 obj_halfscale_x = (obj.bounding_box.max.x - obj.bounding_box.min.x) / 2;
-	f32 obj_halfscale_y = (obj.bounding_box.max.y - obj.bounding_box.min.y) / 2;
-
-	f32 min_distx = enemy_width + obj_halfscale_x;
-	f32 min_disty = enemy_hh + obj_halfscale_y;
-	f32 depth_x = min_distx - fabs(diff_pos.x);
-	f32 depth_y = min_disty - fabs(diff_pos.y);
-
-	if (depth_x != 0 && depth_y != 0)
-	{
-		if (obj.type == GO_TYPE::GO_WALL && fabs(depth_x) < fabs(depth_y))
-		{
-			enemy->curr_pos.x += diff_pos.x < 0 ? -depth_x : +depth_x;
-		}
-
-		if (fabs(depth_y) < fabs(depth_x))
-		{
-			if (diff_pos.y > 0)
-			{
-				enemy->curr_pos.y += depth_y;
-				enemy->curr_vel.y = 0;
-				enemy->on_ground = true;
-			}
-		}
-	}
-	else if (!depth_y && diff_pos.y > 0)
-	{
-		enemy->curr_vel.y = 0;
-		enemy->on_ground = true;
-	}
-}
-
 /*!*****************************************************************************
   \brief
 	This function starts the invulnerable state of the enemy.
@@ -447,26 +397,11 @@ void Enemy::take_damage(s32 damage)
 *******************************************************************************/
 void enemy_collide(gameObject& obj)
 {
-	Enemy* enemy = dynamic_cast<Enemy*>(&obj);
-	vector<gameObject*>& colliders = obj.colliders;
-	for (vector<gameObject*>::iterator i = colliders.begin(); i != colliders.end(); ++i)
+	Enemy* enemy = go_cast<Enemy>(&obj);
+	Collider_List& colliders = obj.colliders;
+	for (Collider_List::iterator i = colliders.begin(); i != colliders.end(); ++i)
 	{
 		gameObject& obj_col = **i;
-		if (obj_col.type == GO_TYPE::GO_PLATFORM
-			&& rtr_collide(obj_col.bounding_box, obj_col.curr_vel, enemy->innerBound, enemy->curr_vel))
-		{
-			AEVec2 e1{ 0,1 };
-			if (AEVec2DotProduct(&enemy->curr_vel, &e1) < 0)
-			{
-				adjust_enemy_movement(obj, obj_col);
-			}
-		}
-		else if (obj_col.type == GO_TYPE::GO_WALL
-			&& rtr_collide(obj_col.bounding_box, obj_col.curr_vel, enemy->innerBound, enemy->curr_vel))
-		{
-			adjust_enemy_movement(obj, obj_col);
-		}
-
 		if (obj_col.type == GO_TYPE::GO_PLAYER)
 		{
 			enemy->behaviour(obj_col);
@@ -474,24 +409,15 @@ void enemy_collide(gameObject& obj)
 
 		if (obj_col.type == GO_TYPE::GO_PLAYERATTACKCOLLIDER)
 		{
-			Attack_Collider* attack_collider = dynamic_cast<Attack_Collider*>(&obj_col);
+			Attack_Collider* attack_collider = go_cast<Attack_Collider>(&obj_col);
 			if (!enemy->is_invul && rtr_collide(enemy->innerBound, enemy->curr_vel, attack_collider->bounding_box, attack_collider->curr_vel))
 			{
-				bool ignore{ false };
-				for (gameObject* x : enemy->ignorecolliders)
-				{
-					if (x == &obj_col)
-					{
-						ignore = true;
-						break;
-					}
-				}
-				if (ignore) continue;
+				// Each attack only hits once
+				if (!contact_first_hit(*enemy, obj_col, get_contact_generation())) continue;
 
 				AEVec2 push = attack_collider->flinch_scale;
 				push.x = enemy->curr_pos.x >= attack_collider->owner->curr_pos.x ? push.x : -push.x;
 				enemy->take_damage(attack_collider->damage);
-				enemy->ignorecolliders.push_back(attack_collider);
 				enemy->on_ground = false;
 				AEVec2Add(&enemy->acceleration, &enemy->acceleration, &push);
 			}
@@ -499,10 +425,10 @@ void enemy_collide(gameObject& obj)
 
 		if (obj_col.type == GO_TYPE::GO_TRAPS)
 		{
-			Traps* trap = dynamic_cast<Traps*>(&obj_col);
+			Traps* trap = go_cast<Traps>(&obj_col);
 			if (rtr_collide(enemy->innerBound, enemy->curr_vel, trap->bounding_box, trap->curr_vel) && trap->traps_type == TRAPS_TYPE::TRAPS_KILLZONE)
 			{
-				enemy->flag = false;
+				destroy_object(enemy);
 			}
 		}
 	}
@@ -521,8 +447,8 @@ MeleeEnemy1::MeleeEnemy1() : Enemy()
   \brief
 	This is the melee enemy parameterized constructor. (slime)
 *******************************************************************************/
-MeleeEnemy1::MeleeEnemy1(s32 health, AEVec2 init_pos, AEVec2 scale, Sprite* sprite)
-	: Enemy(health, init_pos, scale, sprite)
+MeleeEnemy1::MeleeEnemy1(s32 health, AEVec2 init_pos, AEVec2 scale, const Sprite_Asset* asset)
+	: Enemy(health, init_pos, scale, asset)
 {
 	enemy_type = ENEMY_TYPE::ENEMY_SLIME;
 }
@@ -540,8 +466,8 @@ MeleeEnemy2::MeleeEnemy2() : Enemy()
   \brief
 	This is the melee enemy parameterized constructor. (melee skeleton)
 *******************************************************************************/
-MeleeEnemy2::MeleeEnemy2(s32 health, AEVec2 init_pos, AEVec2 scale, Sprite* sprite)
-	: Enemy(health, init_pos, scale, sprite)
+MeleeEnemy2::MeleeEnemy2(s32 health, AEVec2 init_pos, AEVec2 scale, const Sprite_Asset* asset)
+	: Enemy(health, init_pos, scale, asset)
 {
 	enemy_type = ENEMY_TYPE::ENEMY_SKELETON_MELEE;
 }
@@ -558,7 +484,7 @@ void MeleeEnemy2::behaviour(gameObject& gameObj)
 	{
 		if (gameObj.curr_pos.x > curr_pos.x) //if player pos is more than monster pos then
 		{
-			obj_sprite->flip_x = true;
+			render_state.flip_x = true;
 			if (AEVec2Distance(&curr_pos, &Level::player->curr_pos) >= 100.0f)
 			{
 				acceleration.x += 100 * G_DELTATIME * FPS;
@@ -575,7 +501,7 @@ void MeleeEnemy2::behaviour(gameObject& gameObj)
 		}
 		else
 		{
-			obj_sprite->flip_x = false;
+			render_state.flip_x = false;
 			if (AEVec2Distance(&curr_pos, &Level::player->curr_pos) >= 100.0f)
 			{
 				acceleration.x -= 100 * G_DELTATIME * FPS;
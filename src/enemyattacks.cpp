@@ -56,7 +56,7 @@ void enemyattack_load()
 *******************************************************************************/
 void enemy_attack_init(gameObject& enemy)
 {
-	Enemy* enemies = dynamic_cast<Enemy*>(&enemy);
+	Enemy* enemies = go_cast<Enemy>(&enemy);
 	if (enemies->enemy_type == ENEMY_TYPE::ENEMY_SKELETON_RANGED)
 	{
 		enemies->curr_attack = &shoot;
@@ -82,7 +82,7 @@ void enemyattack_unload()
 *******************************************************************************/
 void enemy_shoot(gameObject& gameObj)
 {
-	Enemy* enemy = dynamic_cast<Enemy*>(&gameObj);
+	Enemy* enemy = go_cast<Enemy>(&gameObj);
 
 	if (!Level::player) return;
 	range_atk_sound->play_sound();
@@ -94,9 +94,9 @@ void enemy_shoot(gameObject& gameObj)
 	AEVec2Normalize(&nrmlz, &length);
 	AEVec2Scale(&enemy->collider->curr_vel, &nrmlz, 400.0f);
 	if (enemy->curr_pos.x - Level::player->curr_pos.x < 0)
-		enemy->obj_sprite->flip_x = true;
+		enemy->render_state.flip_x = true;
 	else
-		enemy->obj_sprite->flip_x = false;
+		enemy->render_state.flip_x = false;
 	enemy->collider->curr_pos = enemy->curr_pos;
 	enemy->cooldown_timer = 3.0f;
 }
@@ -107,7 +107,7 @@ void enemy_shoot(gameObject& gameObj)
 *******************************************************************************/
 void enemy_slash(gameObject& gameObj)
 {
-	Enemy* enemy = dynamic_cast<Enemy*>(&gameObj);
+	Enemy* enemy = go_cast<Enemy>(&gameObj);
 
 	if (!Level::player) return;
 
@@ -11,6 +11,7 @@ engine
 
 The functions include:
 - swap
+- reset
 - set_aabb
 - Draw_Obj
 - game_object_load
@@ -20,6 +21,12 @@ The functions include:
 - game_object_unload
 - collision_update
 - cmp_layer
+- get_handle
+- get_object
+- release_handle
+- wake_object
+- destroy_object
+- compact_objects
 
 Copyright (C) 2021 DigiPen Institure of Technology.
 Reproduction or disclosure of this file or its contents
@@ -34,28 +41,49 @@ Technology is prohibited.
 #include "level_manager.h"
 
 AEVec2 def_vec{0, 0};
+static u32 next_id = 0;
+
+struct Handle_Slot
+{
+	gameObject* obj;
+	u32 generation;
+};
+
+// Slots referred to by Object_Handle, released slots are reused
+static vector<Handle_Slot> v_handle_slots;
+static vector<u32> v_free_handles;
+
+// Objects destroyed since the last compact_objects
+static u32 dead_count = 0;
 
 /*!
  * \brief Construct a new game Object::game Object object
  * 
  * 
  */
-gameObject::gameObject() : init_pos{}
+gameObject::gameObject() : gameObject(NO_TRANSFORM)
 {
-	bounding_box = {def_vec, def_vec};
-	curr_pos = def_vec;
-	curr_vel = def_vec;
-	acceleration = def_vec;
-	on_collide = nullptr;
-	obj_sprite = nullptr;
-	layer = 0;
-	state = P_Anim_State::P_NONE;
-	scale = {1.0f, 1.0f};
-	type = GO_TYPE::GO_PLAYER;
-	is_colliding = false;
-	is_static = false;
-	flag = true;
-	on_ground = false;
+}
+
+/*!
+ * \brief Construct a new game Object::game Object object, with its transform
+ * in a slot of the transform store
+ *
+ * \param transform
+ * Slot from transform_store_claim, which the object releases when it is
+ * destroyed. NO_TRANSFORM to keep the transform inside the object.
+ */
+gameObject::gameObject(u32 transform) :
+	curr_pos{ transform == NO_TRANSFORM ? own_pos : transform_store_pos(transform) },
+	init_pos{},
+	bounding_box{ transform == NO_TRANSFORM ? own_box : transform_store_box(transform) },
+	curr_vel{ transform == NO_TRANSFORM ? own_vel : transform_store_vel(transform) },
+	acceleration{ transform == NO_TRANSFORM ? own_acc : transform_store_acc(transform) },
+	transform{ transform }
+{
+	handle = NO_HANDLE;
+	attack_colliders = NO_COLLIDER;
+	reset();
 }
 
 /*!
@@ -73,13 +101,17 @@ gameObject::gameObject() : init_pos{}
  * Type of the game object
  * \param is_static 
  * If the game object moves. Important for collision checking
+ * \param transform
+ * Slot in the transform store to keep the transform in, NO_TRANSFORM by
+ * default
  */
 gameObject::gameObject(AEVec2 pos,
 					   Sprite *sprite,
 					   u32 layer,
 					   AEVec2 scale,
 					   GO_TYPE type,
-					   bool is_static) : gameObject()
+					   bool is_static,
+					   u32 transform) : gameObject(transform)
 {
 	curr_pos = pos;
 	obj_sprite = sprite;
@@ -94,9 +126,15 @@ gameObject::gameObject(AEVec2 pos,
  * Using copy constructor
  *
  * \param rhs 
- * 	Read-only reference to the gameObject to copy
+ * 	Read-only reference to the gameObject to copy. The copy keeps its
+ * 	transform inside the object.
  */
-gameObject::gameObject(const gameObject &rhs)
+gameObject::gameObject(const gameObject &rhs) :
+	curr_pos{ own_pos },
+	bounding_box{ own_box },
+	curr_vel{ own_vel },
+	acceleration{ own_acc },
+	transform{ NO_TRANSFORM }
 {
 	bounding_box = rhs.bounding_box;
 	curr_pos = rhs.curr_pos;
@@ -112,7 +150,43 @@ gameObject::gameObject(const gameObject &rhs)
 	is_static = rhs.is_static;
 	flag = rhs.flag;
 	on_ground = rhs.on_ground;
+	is_asleep = rhs.is_asleep;
+	wake_timer = rhs.wake_timer;
 	init_pos = rhs.init_pos;
+	is_dead = false;
+	id = next_id++;
+	handle = NO_HANDLE;
+	attack_colliders = NO_COLLIDER;
+}
+
+/*!
+ * \brief Releases the handle of a game object, so that get_object no longer
+ * finds it
+ *
+ * \param obj
+ * Reference to the game object
+ */
+static void release_handle(gameObject &obj)
+{
+	if (obj.handle == NO_HANDLE)
+		return;
+	Handle_Slot &slot = v_handle_slots[obj.handle];
+	slot.obj = nullptr;
+	++slot.generation;
+	v_free_handles.push_back(obj.handle);
+	obj.handle = NO_HANDLE;
+}
+
+/*!
+ * \brief Destroy the game Object::game Object object. Handles to it stop
+ * resolving.
+ *
+ */
+gameObject::~gameObject()
+{
+	release_handle(*this);
+	if (transform != NO_TRANSFORM)
+		transform_store_release(transform);
 }
 
 /*!
@@ -126,6 +200,7 @@ void gameObject::swap(gameObject &rhs)
 {
 	std::swap(animations, rhs.animations);
 	std::swap(colliders, rhs.colliders);
+	std::swap(contacts, rhs.contacts);
 	std::swap(bounding_box, rhs.bounding_box);
 	std::swap(curr_pos, rhs.curr_pos);
 	std::swap(curr_vel, rhs.curr_vel);
@@ -140,6 +215,17 @@ void gameObject::swap(gameObject &rhs)
 	std::swap(is_static, rhs.is_static);
 	std::swap(flag, rhs.flag);
 	std::swap(on_ground, rhs.on_ground);
+	std::swap(is_asleep, rhs.is_asleep);
+	std::swap(wake_timer, rhs.wake_timer);
+	std::swap(is_dead, rhs.is_dead);
+	std::swap(id, rhs.id);
+	std::swap(handle, rhs.handle);
+	if (handle != NO_HANDLE)
+		v_handle_slots[handle].obj = this;
+	if (rhs.handle != NO_HANDLE)
+		v_handle_slots[rhs.handle].obj = &rhs;
+	// attack_colliders is not swapped, the colliders point at their owner by address.
+	// transform is not swapped either, the swaps above moved the values between the slots.
 }
 
 /*!
@@ -157,6 +243,40 @@ gameObject &gameObject::operator=(const gameObject &rhs)
 	return *this;
 }
 
+/*!
+ * \brief Resets the game object values in place to the ones of a newly
+ * constructed game object. Its handle is released, so handles to it stop
+ * resolving, and it gets a new id. The lists keep their memory, and
+ * attack_colliders and transform are kept.
+ *
+ */
+void gameObject::reset()
+{
+	release_handle(*this);
+	animations.clear();
+	colliders.clear();
+	contacts.clear();
+	bounding_box = {def_vec, def_vec};
+	curr_pos = def_vec;
+	init_pos = def_vec;
+	curr_vel = def_vec;
+	acceleration = def_vec;
+	on_collide = nullptr;
+	obj_sprite = nullptr;
+	layer = 0;
+	state = P_Anim_State::P_NONE;
+	scale = {1.0f, 1.0f};
+	type = GO_TYPE::GO_PLAYER;
+	is_colliding = false;
+	is_static = false;
+	flag = true;
+	on_ground = false;
+	is_asleep = false;
+	wake_timer = 0.0f;
+	is_dead = false;
+	id = next_id++;
+}
+
 /*!
  * \brief Draws the object if the flag is true
  * 
@@ -206,10 +326,13 @@ void gameObject::game_object_initialize()
  * Same goes to enemy attack collider but with the addition of checking if the 
  * cooldown timer is <= 0. If it is, set the collider flag to false.
  * 
+ * Colliders with a slot in the transform store are moved by the store after
+ * every object has been updated instead.
  */
 void gameObject::game_object_update()
 {
-	if (type == GO_TYPE::GO_BOSSATTACKCOLLIDER || type == GO_TYPE::GO_PLAYERATTACKCOLLIDER)
+	const bool moves_itself = transform == NO_TRANSFORM;
+	if (moves_itself && (type == GO_TYPE::GO_BOSSATTACKCOLLIDER || type == GO_TYPE::GO_PLAYERATTACKCOLLIDER))
 	{
 		AEVec2Add(&curr_vel, &curr_vel, &acceleration);
 		AEVec2 dt_vel;
@@ -219,21 +342,23 @@ void gameObject::game_object_update()
 
 	if (type == GO_TYPE::GO_ENEMYATTACKCOLLIDER)
 	{
-		Attack_Collider *atk_col = dynamic_cast<Attack_Collider *>(this);
+		Attack_Collider *atk_col = go_cast<Attack_Collider>(this);
 		if (atk_col->owner)
 		{
-			AEVec2 dt_vel;
-			AEVec2Scale(&dt_vel, &curr_vel, G_DELTATIME);
-			AEVec2Add(&curr_pos, &dt_vel, &curr_pos);
+			if (moves_itself)
+			{
+				AEVec2 dt_vel;
+				AEVec2Scale(&dt_vel, &curr_vel, G_DELTATIME);
+				AEVec2Add(&curr_pos, &dt_vel, &curr_pos);
+			}
 
-			Attack_Collider *collider = dynamic_cast<Attack_Collider *>(this);
-			Enemy *enemy = dynamic_cast<Enemy *>(collider->owner);
+			Enemy *enemy = go_cast<Enemy>(atk_col->owner);
 			if (enemy && enemy->cooldown_timer <= 0)
 			{
-				collider->flag = false;
+				atk_col->flag = false;
 			}
 		}
-		else
+		else if (moves_itself)
 		{
 			AEVec2Add(&curr_vel, &curr_vel, &acceleration);
 			AEVec2 dt_vel;
@@ -294,4 +419,118 @@ void gameObject::game_object_unload()
 bool cmp_layer(gameObject *const &lhs, gameObject *const &rhs)
 {
 	return (lhs->layer < rhs->layer);
-}
\ No newline at end of file
+}
+
+/*!
+ * \brief Gets a handle to a game object, giving it one if it has none
+ *
+ * \param obj
+ * Pointer to the game object
+ * \return Object_Handle
+ * Handle to the game object, NULL_HANDLE if obj is null
+ */
+Object_Handle get_handle(gameObject *obj)
+{
+	if (!obj)
+		return NULL_HANDLE;
+	if (obj->handle == NO_HANDLE)
+	{
+		if (v_free_handles.empty())
+		{
+			obj->handle = static_cast<u32>(v_handle_slots.size());
+			v_handle_slots.push_back({obj, 0});
+		}
+		else
+		{
+			obj->handle = v_free_handles.back();
+			v_free_handles.pop_back();
+			v_handle_slots[obj->handle].obj = obj;
+		}
+	}
+	return {obj->handle, v_handle_slots[obj->handle].generation};
+}
+
+/*!
+ * \brief Gets the game object of a handle
+ *
+ * \param handle
+ * Handle from get_handle
+ * \return gameObject*
+ * The game object, or nullptr if it was destroyed or reassigned since the
+ * handle was made
+ */
+gameObject *get_object(Object_Handle handle)
+{
+	if (handle.index >= v_handle_slots.size())
+		return nullptr;
+	const Handle_Slot &slot = v_handle_slots[handle.index];
+	return slot.generation == handle.generation ? slot.obj : nullptr;
+}
+
+/*!
+ * \brief Wakes up a sleeping game object, and keeps it awake for
+ * WAKE_DURATION even if it is away from the camera, so that whatever woke it
+ * can still reach it
+ *
+ * \param obj
+ * Pointer to the game object
+ */
+void wake_object(gameObject *obj)
+{
+	obj->is_asleep = false;
+	obj->wake_timer = WAKE_DURATION;
+}
+
+/*!
+ * \brief Switches off a game object for good. It stays in the vector of game
+ * objects until compact_objects deletes it at the end of the frame.
+ *
+ * \param obj
+ * Pointer to a game object allocated with new
+ */
+void destroy_object(gameObject *obj)
+{
+	obj->flag = false;
+	if (obj->is_dead)
+		return;
+	obj->is_dead = true;
+	++dead_count;
+}
+
+/*!
+ * \brief Removes the destroyed game objects from the vector in one pass,
+ * keeping the order of the rest, and deletes them. Their attack colliders
+ * are released first so that none is left with a dangling owner.
+ *
+ * \param v_obj
+ * Reference to the vector of game objects
+ */
+void compact_objects(vector<gameObject *> &v_obj)
+{
+	static vector<gameObject *> v_dead;
+	if (!dead_count)
+		return;
+
+	for (size_t i{0}; i < v_obj.size(); ++i)
+	{
+		if (!v_obj[i]->is_dead)
+			continue;
+		while (Attack_Collider *collider = get_attack_collider(v_obj[i]))
+			release_attack_collider(collider);
+	}
+
+	size_t live{0};
+	for (size_t i{0}; i < v_obj.size(); ++i)
+	{
+		if (v_obj[i]->is_dead)
+			v_dead.push_back(v_obj[i]);
+		else
+			v_obj[live++] = v_obj[i];
+	}
+	v_obj.resize(live);
+
+	for (gameObject *obj : v_dead)
+		delete obj;
+	v_dead.clear();
+	dead_count = 0;
+}
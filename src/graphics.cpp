@@ -33,14 +33,8 @@ Technology is prohibited.
  * @brief Construct a new Sprite:: Sprite object
  * 
  */
-Sprite::Sprite() : size{ 1.0f, 1.0f }, texture{ nullptr }, rot{ 0.0f }, flip_x{ false }, flip_y(false)
+Sprite::Sprite() : Sprite_Asset(), Render_State()
 {
-	texture = nullptr;
-	mesh = nullptr;
-	offset = { 0.0f, 0.0f };
-	tint = { 1.0, 1.0, 1.0, 1.0 };
-	transparency = 1.0f;
-	scale = { 1.0f, 1.0f };
 }
 
 /**
@@ -83,9 +77,7 @@ Sprite::Sprite(AEGfxTexture* tex,
  * @param rhs 
  * Reference to the sprite to copy
  */
-Sprite::Sprite(Sprite const& rhs) : texture{ rhs.texture }, mesh{ rhs.mesh }, offset{ rhs.offset },
-tint{ rhs.tint }, transparency{ rhs.transparency }, size{ rhs.size }, scale{ rhs.scale },
-rot{ rhs.rot }, flip_x{ rhs.flip_x }, flip_y{ rhs.flip_y } {}
+Sprite::Sprite(Sprite const& rhs) : Sprite_Asset(rhs), Render_State(rhs) {}
 
 /**
  * @brief Destroy the Sprite:: Sprite object
@@ -257,6 +249,41 @@ void draw(AEGfxTexture* texture,
 	AEGfxMeshDraw(mesh, AE_GFX_MDM_TRIANGLES);
 }
 
+/**
+ * @brief Draw an instance of a shared sprite asset with zoom factor from the
+ * camera
+ *
+ * @param asset
+ * Texture, mesh and texture size shared by every instance
+ * @param state
+ * Texture offset, tint, rotation and flipping of this instance
+ * @param position
+ * Position
+ * @param scale
+ * Scale factor
+ */
+void draw(const Sprite_Asset& asset, const Render_State& state, AEVec2 position, AEVec2 scale)
+{
+	AEVec2 temp_scale = scale;
+	if (state.flip_x && state.flip_y)
+	{
+		temp_scale = { -scale.x, -scale.y };
+	}
+	else if (state.flip_x)
+	{
+		temp_scale = { -scale.x, scale.y };
+	}
+	else if (state.flip_y)
+	{
+		temp_scale = { scale.x, -scale.y };
+	}
+	AEVec2 tex_offset = state.offset;
+	tex_offset.x = tex_offset.x / asset.size.x;
+	tex_offset.y = tex_offset.y / asset.size.y;
+	draw(asset.texture, asset.mesh, position,
+		tex_offset, state.tint, state.transparency, temp_scale, state.rot);
+}
+
 /**
  * @brief Draw the sprite with zoom factor from the camera
  * 
@@ -270,26 +297,7 @@ void draw(AEGfxTexture* texture,
 void draw(const Sprite* sprite, const AEVec2 position, AEVec2 scale)
 {
 	if (sprite)
-	{
-		AEVec2 temp_scale = scale;
-		if (sprite->flip_x && sprite->flip_y)
-		{
-			temp_scale = { -scale.x, -scale.y };
-		}
-		else if (sprite->flip_x)
-		{
-			temp_scale = { -scale.x, scale.y };
-		}
-		else if (sprite->flip_y)
-		{
-			temp_scale = { scale.x, -scale.y };
-		}
-		AEVec2 tex_offset = sprite->offset;
-		tex_offset.x = tex_offset.x / sprite->size.x;
-		tex_offset.y = tex_offset.y / sprite->size.y;
-		draw(sprite->texture, sprite->mesh, position,
-			tex_offset, sprite->tint, sprite->transparency, temp_scale, sprite->rot);
-	}
+		draw(*sprite, *sprite, position, scale);
 }
 
 /**
@@ -0,0 +1,172 @@
+/*!*************************************************************************
+****
+\file   kinematic.cpp
+\author agent
+\par    email: agent\@local
+\date   Oct 17 2026
+
+\brief
+This file contains the implementation of the kinematic body resolver of the
+collision system in the game engine.
+
+Every body is resolved as a box centred on its position, so the result does
+not depend on how each type sets up its bounding box. The resolver runs once
+over every body after the colliders are found and before any on_collide
+function is called, which then only has to react to on_ground. It reads the
+contacts found by the narrowphase instead of testing the boxes again, only
+moving each contact from the bounding box onto the resolved box.
+
+The functions include:
+- get_body_params
+- resolve_body
+- resolve_bodies
+
+Copyright (C) 2026 DigiPen Institure of Technology.
+Reproduction or disclosure of this file or its contents
+without the prior written consent of DigiPen Institute of
+Technology is prohibited.
+****************************************************************************
+***/
+#include "main.h"
+#include <cfloat>
+#include "kinematic.h"
+
+// Parameters of each type, types with no floor or solid are not bodies
+static const Body_Params BODY_PARAMS[static_cast<u32>(GO_TYPE::GO_TOTAL)]
+{
+	// GO_PLAYER: can only step onto floors up to 30 units above its feet
+	{ { 0.25f, 0.475f }, 30.0f,
+	go_type_bit(GO_TYPE::GO_PLATFORM) | go_type_bit(GO_TYPE::GO_DESTRUCTABLE), go_type_bit(GO_TYPE::GO_WALL), false, true },
+	// GO_MONSTER: resolved by its inner bound, keeps on_ground until it is hit
+	{ { 0.5f, 0.5f }, FLT_MAX, go_type_bit(GO_TYPE::GO_PLATFORM), go_type_bit(GO_TYPE::GO_WALL), false, false },
+	// GO_BOSS
+	{ { 0.5f, 0.5f }, FLT_MAX, go_type_bit(GO_TYPE::GO_PLATFORM), go_type_bit(GO_TYPE::GO_WALL), false, true },
+	// GO_UI
+	{},
+	// GO_PLATFORM
+	{},
+	// GO_WALL
+	{},
+	// GO_DESTRUCTABLE
+	{},
+	// GO_COLLECTABLES: hearts treat platforms as solid from every side
+	{ { 0.5f, 0.5f }, FLT_MAX, 0u, go_type_bit(GO_TYPE::GO_PLATFORM), true, false },
+	// GO_PROJECTILE
+	{},
+	// GO_PLAYERATTACKCOLLIDER
+	{},
+	// GO_ENEMYATTACKCOLLIDER
+	{},
+	// GO_BOSSATTACKCOLLIDER
+	{},
+	// GO_BOSS_SPAWNER
+	{},
+	// GO_TRAPS
+	{},
+	// GO_PARTICLE
+	{},
+	// GO_PARTICLESYSTEM
+	{},
+	// GO_ATTACKINDICATOR
+	{}
+};
+
+/*!****************************************************************************
+ * @brief Gets the resolver parameters of a type
+ *
+ * @param type
+ * Type of the game object
+ * @return const Body_Params*
+ * Parameters of the type, nullptr if the type is not a body
+******************************************************************************/
+const Body_Params* get_body_params(GO_TYPE type)
+{
+	const Body_Params& params = BODY_PARAMS[static_cast<u32>(type)];
+	return params.floor_mask | params.solid_mask ? &params : nullptr;
+}
+
+/*!****************************************************************************
+ * @brief Pushes a body out of the floors and solids it is colliding with.
+ *
+ * If the body overlaps a solid less horizontally than vertically, it is pushed
+ * out sideways. Otherwise if it is above the floor or solid and no deeper than
+ * its step height, it is lifted on top, its vertical velocity is zeroed and it
+ * is put on the ground. Floors are only landed on while the body is falling.
+ * A body that exactly touches the top of what it collides with is also put on
+ * the ground.
+ *
+ * @param obj
+ * Reference to the game object of the body
+ * @param params
+ * Parameters of the body
+******************************************************************************/
+void resolve_body(gameObject& obj, const Body_Params& params)
+{
+	if (params.drops)
+		obj.on_ground = false;
+
+	AEVec2 half{ params.extent.x * obj.scale.x, params.extent.y * obj.scale.y };
+	// The contacts were measured from the bounding box, which is not moved here
+	AEVec2 box_half{ (obj.bounding_box.max.x - obj.bounding_box.min.x) / 2, (obj.bounding_box.max.y - obj.bounding_box.min.y) / 2 };
+	AEVec2 box_centre{ obj.bounding_box.min.x + box_half.x, obj.bounding_box.min.y + box_half.y };
+	for (u32 i{ 0 }; i < obj.colliders.size(); ++i)
+	{
+		u32 bit = go_type_bit(obj.colliders[i]->type);
+		bool solid = (params.solid_mask & bit) != 0;
+		if (!solid && (!(params.floor_mask & bit) || obj.curr_vel.y >= 0))
+			continue;
+
+		// Move the contact onto the resolved box, whose position moves with every collider resolved
+		const Contact& contact = obj.contacts[i];
+		AEVec2 offset{ contact.offset.x + obj.curr_pos.x - box_centre.x, contact.offset.y + obj.curr_pos.y - box_centre.y };
+		f32 depth_x = contact.depth.x + fabs(contact.offset.x) - box_half.x + half.x - fabs(offset.x);
+		f32 depth_y = contact.depth.y + fabs(contact.offset.y) - box_half.y + half.y - fabs(offset.y);
+		if (depth_x < 0 || depth_y < 0)
+			continue;
+
+		if (depth_x != 0 && depth_y != 0)
+		{
+			if (solid && fabs(depth_x) < fabs(depth_y))
+			{
+				obj.curr_pos.x += offset.x < 0 ? -depth_x : depth_x;
+			}
+			else if (fabs(depth_y) <= fabs(depth_x))
+			{
+				if (offset.y > 0 && depth_y <= params.step_height)
+				{
+					obj.curr_pos.y += depth_y;
+					obj.curr_vel.y = 0;
+					obj.on_ground = true;
+				}
+				else if (offset.y < 0 && solid && params.ceilings)
+				{
+					obj.curr_pos.y -= depth_y;
+					obj.curr_vel.y = 0;
+				}
+			}
+		}
+		else if (!depth_y && offset.y > 0)
+		{
+			obj.curr_vel.y = 0;
+			obj.on_ground = true;
+		}
+	}
+}
+
+/*!****************************************************************************
+ * @brief Resolves every body that is colliding with something this frame
+ *
+ * @param v_obj
+ * Vector of game objects
+******************************************************************************/
+void resolve_bodies(vector<gameObject*>& v_obj)
+{
+	for (gameObject* obj : v_obj)
+	{
+		if (obj->colliders.empty())
+			continue;
+		const Body_Params* params = get_body_params(obj->type);
+		if (params)
+			resolve_body(*obj, *params);
+	}
+}
@@ -75,7 +75,7 @@ void level2_initialize()
 /******************************************************************************
  * @brief Update function of the level2 game state
  * Updates the level and its objects as well as updating the collisions and 
- * background position. Accomodate for pause as well.
+ * background position. Destroyed objects are deleted last. Accomodate for pause as well.
  * 
 ******************************************************************************/
 void level2_update()
@@ -86,6 +86,7 @@ void level2_update()
 		level->update();
 		level_objects_update(level->v_gameObjects);
 		collision_update(level->v_gameObjects);
+		compact_objects(level->v_gameObjects);
 		AEVec2 default_pos = level->level_cam.get_curr_pos();
 		bg_pos = default_pos;
 	}
@@ -74,7 +74,7 @@ void level3_initialize()
 /******************************************************************************
  * @brief Update function of the level3 game state
  * Updates the level and its objects as well as updating the collisions and 
- * background position. Accomodate for pause as well.
+ * background position. Destroyed objects are deleted last. Accomodate for pause as well.
  * 
 ******************************************************************************/
 void level3_update()
@@ -85,6 +85,7 @@ void level3_update()
 		level->update();
 		level_objects_update(level->v_gameObjects);
 		collision_update(level->v_gameObjects);
+		compact_objects(level->v_gameObjects);
 		AEVec2 default_pos = level->level_cam.get_curr_pos();
 		bg_pos = default_pos;
 	}
@@ -0,0 +1,100 @@
+/*!*************************************************************************
+****
+\file   level_arena.cpp
+\author agent
+\par    email: agent\@local
+\date   Oct 17 2026
+
+\brief
+This file contains the implementation of the level arena of the game engine.
+
+Only what the level asks for with level_arena_create comes from the arena,
+which is the platforms, walls, sprites and area containers that are loaded
+with the level and destroyed by its destructor. Anything that can be
+deleted while the level runs, such as enemies and traps, is still made with
+new, so the arena never has to tell its memory apart from the heap.
+
+The functions include:
+- level_arena_release
+- level_arena_alloc
+- get_level_arena_stats
+
+Copyright (C) 2026 DigiPen Institure of Technology.
+Reproduction or disclosure of this file or its contents
+without the prior written consent of DigiPen Institute of
+Technology is prohibited.
+****************************************************************************
+***/
+#include "level_arena.h"
+#include <cstdlib>
+#include <vector>
+
+struct Arena_Block
+{
+	char* begin;
+	size_t size;
+	size_t used;
+};
+
+static std::vector<Arena_Block> v_blocks;
+static Level_Arena_Stats stats{};
+
+/*!****************************************************************************
+ * @brief Frees every block of the arena. Everything in it must have been
+ * destroyed already.
+******************************************************************************/
+void level_arena_release()
+{
+	for (Arena_Block& block : v_blocks)
+		std::free(block.begin);
+	v_blocks.clear();
+	stats = {};
+}
+
+/*!****************************************************************************
+ * @brief Allocates memory from the current block of the arena, starting a new
+ * block when it is full
+ *
+ * @param size
+ * Size of the allocation in bytes
+ * @param align
+ * Alignment of the allocation, a power of two
+ * @return void*
+ * Pointer to the memory
+******************************************************************************/
+void* level_arena_alloc(size_t size, size_t align)
+{
+	size_t offset{ 0 };
+	if (!v_blocks.empty())
+	{
+		Arena_Block& block = v_blocks.back();
+		offset = (block.used + align - 1) & ~(align - 1);
+	}
+	if (v_blocks.empty() || offset + size > v_blocks.back().size)
+	{
+		size_t block_size = size + align > LEVEL_ARENA_BLOCK_SIZE ? size + align : LEVEL_ARENA_BLOCK_SIZE;
+		char* memory = static_cast<char*>(std::malloc(block_size));
+		AE_ASSERT_MESG(memory, "Failed to allocate a block of the level arena!");
+		v_blocks.push_back({ memory, block_size, 0 });
+		++stats.blocks;
+		stats.reserved += block_size;
+		offset = ((reinterpret_cast<size_t>(memory) + align - 1) & ~(align - 1)) - reinterpret_cast<size_t>(memory);
+	}
+
+	Arena_Block& block = v_blocks.back();
+	stats.bytes += offset + size - block.used;
+	block.used = offset + size;
+	++stats.allocations;
+	return block.begin + offset;
+}
+
+/*!****************************************************************************
+ * @brief Gets the allocation counters of the current level
+ *
+ * @return const Level_Arena_Stats&
+ * Allocations, blocks and bytes of the arena
+******************************************************************************/
+const Level_Arena_Stats& get_level_arena_stats()
+{
+	return stats;
+}
@@ -28,6 +28,10 @@ Technology is prohibited.
 #include "collectables.h"
 #include "player_data.h"
 #include "pause.h"
+#include "broadphase.h"
+#include "contact.h"
+#include "platform.h"
+#include "level_arena.h"
 
 static bool fullscreen = false;
 Level *Level::pLevel;
@@ -37,9 +41,9 @@ gameObject *Level::boss_room_wall;
 AABB Level::boss_room_camera;
 Camera Level::level_cam;
 vector<gameObject *> Level::v_gameObjects;
-vector<Sprite *> Level::v_sprites;
-vector<vector<Enemy *> *> Level::v_area_enemies;
+vector<vector<Object_Handle> *> Level::v_area_enemies;
 vector<vector<gameObject *> *> Level::v_area_walls;
+vector<gameObject *> Level::v_static_objects;
 AEVec2 Level::level_scale;
 
 static AEGfxVertexList *enemies_left_mesh = 0;
@@ -109,7 +113,7 @@ Level::Level(const char *level_path) : area_cam{{}, {}}, boss_init_pos{}, curren
 	boss->game_object_load();
 	boss->init_pos = boss_init_pos;
 	area_clear_sound = new Audio("./Audio/level_area_clear.wav", AUDIO_GROUP::SFX);
-	heart_load();
+	collectables_load();
 	particle_system_load();
 	enemyattack_load();
 	pause_load();
@@ -119,7 +123,7 @@ Level::Level(const char *level_path) : area_cam{{}, {}}, boss_init_pos{}, curren
  * @brief Destroy the Level:: Level object. This doubles as the unload function
  *  of the level. The audio allocated to this level will be deleted, as well as
  * the mesh for enemies left, all allocated data in m_meshes, m_textures,
- * m_sprites, v_area_enemies, v_sprites, and v_area_walls. All loaded systems
+ * m_sprites, v_area_enemies, and v_area_walls. All loaded systems
  * will de deallocated here aswell. The player and boss will be deleted last.
  *
 ******************************************************************************/
@@ -149,7 +153,7 @@ Level::~Level()
 
 	for (auto &a : m_sprites)
 	{
-		delete a.second;
+		level_arena_destroy(a.second);
 	}
 	m_sprites.clear();
 
@@ -157,25 +161,33 @@ Level::~Level()
 	{
 		for (auto &b : *a)
 		{
-			remove_attack_collider(b);
+			if (gameObject *enemy = get_object(b))
+				remove_attack_collider(enemy);
 		}
-		delete a;
+		level_arena_destroy(a);
 	}
 	v_area_enemies.clear();
 
-	for (auto &a : v_sprites)
+	for (auto &a : v_area_walls)
 	{
-		delete a;
+		level_arena_destroy(a);
 	}
-	v_sprites.clear();
+	v_area_walls.clear();
 
-	for (auto &a : v_area_walls)
+	// The platforms, walls and boss spawner are in the level arena, so they
+	// are taken out of v_gameObjects before the rest are deleted
+	std::sort(v_static_objects.begin(), v_static_objects.end());
+	v_gameObjects.erase(std::remove_if(v_gameObjects.begin(), v_gameObjects.end(), [](gameObject *obj)
+		{ return std::binary_search(v_static_objects.begin(), v_static_objects.end(), obj); }), v_gameObjects.end());
+	for (auto &a : v_static_objects)
 	{
-		delete a;
+		level_arena_destroy(a);
 	}
-	v_area_walls.clear();
+	v_static_objects.clear();
+	broadphase_clear();
+	contact_clear();
 	attacks_unload();
-	heart_unload();
+	collectables_unload();
 	unload_enemy_assets();
 	particle_system_unload();
 	pause_unload();
@@ -224,9 +236,9 @@ Level::~Level()
 
 		else if (a->type == GO_TYPE::GO_PARTICLESYSTEM)
 		{
+			// Not put back in the free list, which was emptied by particle_system_unload
 			particleSystem *b = dynamic_cast<particleSystem *>(a);
-			if (b->flag)
-				b->delete_system();
+			clear_particles(*b);
 			delete b;
 			continue;
 		}
@@ -276,6 +288,7 @@ Level::~Level()
 
 	delete player;
 	delete boss;
+	level_arena_release();
 }
 
 /*!****************************************************************************
@@ -285,6 +298,7 @@ Level::~Level()
  * setting the player as the default target with boundaries specified in
  * area_cam. The player and boss game object will be pushed to v_gameobjects
  * and the audio system will initialize and play the background music on loop.
+ * The static objects of the level are handed to the broadphase last.
  *
 ******************************************************************************/
 void Level::init()
@@ -305,11 +319,15 @@ void Level::init()
 	v_gameObjects.push_back(boss);
 	for (auto &a : *v_area_enemies[current_area])
 	{
-		a->flag = true;
-		a->game_object_initialize();
+		gameObject *enemy = get_object(a);
+		if (!enemy)
+			continue;
+		enemy->flag = true;
+		enemy->game_object_initialize();
 	}
 	AudioSystem::instance()->init();
 	bg_music->play_sound(1.0f, true);
+	broadphase_set_static(v_static_objects);
 }
 
 /*!****************************************************************************
@@ -340,7 +358,9 @@ void Level::update()
 		int temp_count_enemy = 0;
 		for (auto &a : *v_area_enemies[current_area])
 		{
-			if (a->flag)
+			// Killed enemies have been deleted and no longer resolve
+			gameObject *enemy = get_object(a);
+			if (enemy && enemy->flag)
 				++temp_count_enemy;
 		}
 		enemy_counter = temp_count_enemy;
@@ -350,6 +370,7 @@ void Level::update()
 			for (auto &a : *v_area_walls[current_area])
 			{
 				particleSystem *pParticleSystem = create_particlesystem(a);
+				pParticleSystem->priority = PARTICLE_PRIORITY::AMBIENT;
 				pParticleSystem->color_range[0] = {0.3f, 0.3f, 0.3f, 0.6f};
 				pParticleSystem->color_range[1] = {0.4f, 0.4f, 0.4f, 0.8f};
 				pParticleSystem->scale_range[0] = {75.0f, 75.0f};
@@ -377,9 +398,15 @@ void Level::update()
 				level_cam.set_max_boundary(v_area_walls[current_area]->at(0)->curr_pos);
 				for (auto &a : *v_area_enemies[current_area])
 				{
-					a->flag = true;
-					a->game_object_initialize();
+					gameObject *enemy = get_object(a);
+					if (!enemy)
+						continue;
+					enemy->flag = true;
+					wake_object(enemy);
+					enemy->game_object_initialize();
 				}
+				for (auto &a : *v_area_walls[current_area])
+					wake_object(a);
 			}
 			else
 			{
@@ -568,7 +595,7 @@ bool Level::load_sprites(const rapidjson::Document &d)
 			AE_ASSERT_MESG(spr_mesh, "Failed to create mesh!");
 			m_meshes.insert({spr_name + tex, spr_mesh});
 		}
-		Sprite *s = new Sprite(spr_tex, spr_mesh);
+		Sprite *s = level_arena_create<Sprite>(spr_tex, spr_mesh);
 		s->set_size(size);
 		m_sprites.insert({spr_name, s});
 	}
@@ -603,10 +630,9 @@ bool Level::load_bgm(const rapidjson::Document &d)
  * In the json file, search for the "Enemy" array and "Areas" member.
  * Memory will be reserved for each area in v_area_enemies.
  * In each enemy member in the array, created a new enemy using its sprite,
- * position, scale, health, area, and type values. As each enemy should have a
- * unique sprite, a new sprite object will be created using the copy
- * constructor of Sprite. The constructor of the enemy differs from the type
- *  of enemy.
+ * position, scale, health, area, and type values. Enemies of the same sprite
+ * share its texture and mesh, and each keeps its own render state. The
+ * constructor of the enemy differs from the type of enemy.
  * 
  * @param d 
  * Rapidjson document
@@ -622,7 +648,7 @@ bool Level::load_enemies(const rapidjson::Document &d)
 	v_area_enemies.reserve(areas);
 	for (int i{0}; i < areas; ++i)
 	{
-		vector<Enemy *> *v_area = new vector<Enemy *>;
+		vector<Object_Handle> *v_area = level_arena_create<vector<Object_Handle>>();
 		v_area->reserve(MAX_AREA_ENEMY);
 		v_area_enemies.push_back(v_area);
 	}
@@ -635,12 +661,12 @@ bool Level::load_enemies(const rapidjson::Document &d)
 		float scale_y = e.FindMember("ScaleY")->value.GetFloat();
 		int health = e.FindMember("Health")->value.GetInt();
 		int area = e.FindMember("Area")->value.GetInt();
-		Sprite *enemy_sprite = new Sprite(*m_sprites.at(spr_name));
+		const Sprite_Asset *enemy_asset = m_sprites.at(spr_name);
 		string enemy_type = e.FindMember("Type")->value.GetString();
 		Enemy *enemy_obj = 0;
 		if (enemy_type == "Melee")
 		{
-			enemy_obj = new MeleeEnemy2(health, {pos_x, pos_y}, {scale_x, scale_y}, enemy_sprite);
+			enemy_obj = new MeleeEnemy2(health, {pos_x, pos_y}, {scale_x, scale_y}, enemy_asset);
 		}
 		else if (enemy_type == "Ranged")
 		{
@@ -649,17 +675,16 @@ bool Level::load_enemies(const rapidjson::Document &d)
 				range = e.FindMember("Range")->value.GetFloat();
 			else
 				range = 1.0f;
-			enemy_obj = new RangedEnemy(health, {pos_x, pos_y}, {scale_x, scale_y}, enemy_sprite, range);
+			enemy_obj = new RangedEnemy(health, {pos_x, pos_y}, {scale_x, scale_y}, enemy_asset, range);
 		}
 		else
 		{
-			enemy_obj = new MeleeEnemy1(health, {pos_x, pos_y}, {scale_x, scale_y}, enemy_sprite);
+			enemy_obj = new MeleeEnemy1(health, {pos_x, pos_y}, {scale_x, scale_y}, enemy_asset);
 		}
 		enemy_obj->game_object_load();
 		enemy_obj->flag = false;
-		v_sprites.push_back(enemy_sprite);
 		v_gameObjects.push_back(enemy_obj);
-		v_area_enemies[area]->push_back(enemy_obj);
+		v_area_enemies[area]->push_back(get_handle(enemy_obj));
 	}
 	load_enemy_assets();
 	return true;
@@ -686,7 +711,7 @@ bool Level::load_area(const rapidjson::Document &d)
 	v_area_walls.reserve(areas);
 	for (int i{0}; i < areas; ++i)
 	{
-		vector<gameObject *> *v_area = new vector<gameObject *>;
+		vector<gameObject *> *v_area = level_arena_create<vector<gameObject *>>();
 		v_area->reserve(MAX_AREA_WALLS);
 		v_area_walls.push_back(v_area);
 	}
@@ -701,13 +726,14 @@ bool Level::load_area(const rapidjson::Document &d)
 		if (a.HasMember("Sprite"))
 		{
 			string plat_sprite = a.FindMember("Sprite")->value.GetString();
-			g_obj = new gameObject({x, y}, m_sprites.at(plat_sprite), LAYER_PLATFORM, scale, GO_TYPE::GO_WALL, true);
+			g_obj = level_arena_create<gameObject>(AEVec2{x, y}, m_sprites.at(plat_sprite), LAYER_PLATFORM, scale, GO_TYPE::GO_WALL, true);
 		}
 		else
 		{
-			g_obj = new gameObject({x, y}, nullptr, LAYER_PLATFORM, scale, GO_TYPE::GO_WALL, true);
+			g_obj = level_arena_create<gameObject>(AEVec2{x, y}, nullptr, LAYER_PLATFORM, scale, GO_TYPE::GO_WALL, true);
 		}
 		v_gameObjects.push_back(g_obj);
+		v_static_objects.push_back(g_obj);
 		if (a.HasMember("Area"))
 		{
 			int area = a.FindMember("Area")->value.GetInt();
@@ -719,9 +745,9 @@ bool Level::load_area(const rapidjson::Document &d)
 
 /*!****************************************************************************
  * @brief Load all the traps from the rapidjson document
- * In the array of "Traps", create traps based on the X, Y, scale, type, and 
- * sprite member values. The traps are constructed differently based on the 
- * type of the trap.
+ * In the array of "Traps", create traps based on the X, Y, scale, and type
+ * member values. The traps are constructed differently based on the type of
+ * the trap, and share the sprite asset of their type.
  * 
  * @param d 
  * Rapidjson document
@@ -744,30 +770,27 @@ bool Level::load_traps(const rapidjson::Document &d)
 		f32 scale_y = tr.FindMember("ScaleY")->value.GetFloat();
 		AEVec2 scale = {scale_x, scale_y};
 		string s = tr.FindMember("Type")->value.GetString();
-		string sprite_str = tr.FindMember("Sprite")->value.GetString();
-		Sprite *trap_spr = new Sprite(*m_sprites.at(sprite_str));
-		v_sprites.emplace_back(trap_spr);
 		if (s == "Spike")
 		{
-			SpikeTraps *spike = new SpikeTraps({x, y}, scale, TRAPS_TYPE::TRAPS_SPIKE, trap_spr);
+			SpikeTraps *spike = new SpikeTraps({x, y}, scale, TRAPS_TYPE::TRAPS_SPIKE);
 			spike->game_object_initialize();
 			v_gameObjects.push_back(spike);
 		}
 		else if (s == "Icicle")
 		{
-			IciclesTraps *icicle = new IciclesTraps({x, y}, scale, TRAPS_TYPE::TRAPS_ICICLES, trap_spr);
+			IciclesTraps *icicle = new IciclesTraps({x, y}, scale, TRAPS_TYPE::TRAPS_ICICLES);
 			icicle->game_object_initialize();
 			v_gameObjects.push_back(icicle);
 		}
 		else if (s == "Fire")
 		{
-			LavaTraps *lava = new LavaTraps({x, y}, scale, TRAPS_TYPE::TRAPS_FIRE, trap_spr);
+			LavaTraps *lava = new LavaTraps({x, y}, scale, TRAPS_TYPE::TRAPS_FIRE);
 			lava->game_object_initialize();
 			v_gameObjects.push_back(lava);
 		}
 		else
 		{
-			Traps *trap = new Traps({x, y}, scale, TRAPS_TYPE::TRAPS_KILLZONE, trap_spr);
+			Traps *trap = new Traps({x, y}, scale, TRAPS_TYPE::TRAPS_KILLZONE);
 			trap->game_object_initialize();
 			v_gameObjects.push_back(trap);
 		}
@@ -818,14 +841,16 @@ bool Level::load_boss(const rapidjson::Document &d)
 	AEVec2 boss_room_scale = {boss_room_scalex, boss_room_scaley};
 	AEVec2 min = {cam_min_x, cam_min_y};
 	AEVec2 max = {cam_max_x, cam_max_y};
-	gameObject *g_obj = new gameObject({trigger_x, trigger_y}, nullptr, LAYER_PLATFORM, scale, GO_TYPE::GO_BOSS_SPAWNER, true);
-	boss_room_wall = new gameObject({boss_room_x, boss_room_y}, nullptr, LAYER_PLATFORM, boss_room_scale, GO_TYPE::GO_WALL, true);
+	gameObject *g_obj = level_arena_create<gameObject>(AEVec2{trigger_x, trigger_y}, nullptr, LAYER_PLATFORM, scale, GO_TYPE::GO_BOSS_SPAWNER, true);
+	boss_room_wall = level_arena_create<gameObject>(AEVec2{boss_room_x, boss_room_y}, nullptr, LAYER_PLATFORM, boss_room_scale, GO_TYPE::GO_WALL, true);
 	boss_room_wall->flag = false;
 	boss_room_camera.min = min;
 	boss_room_camera.max = max;
 	g_obj->on_collide = spawner_collide;
 	v_gameObjects.push_back(g_obj);
 	v_gameObjects.push_back(boss_room_wall);
+	v_static_objects.push_back(g_obj);
+	v_static_objects.push_back(boss_room_wall);
 	return true;
 }
 
@@ -855,17 +880,25 @@ bool Level::load_camera_bounds(const rapidjson::Document &d)
 }
 
 /*!****************************************************************************
- * @brief Add a platform to the level based on the position.
+ * @brief Add a platform to the level based on the position. The platform
+ * covers columns by rows tiles of level_scale.
  * 
  * @param pos 
- * Coordinate of the platform to place
+ * Coordinate of the centre of the platform to place
+ * @param columns 
+ * Number of tiles along x
+ * @param rows 
+ * Number of tiles along y
 ******************************************************************************/
-void Level::add_platform(AEVec2 const &pos)
+void Level::add_platform(AEVec2 const &pos, s32 columns, s32 rows)
 {
+	gameObject *g_obj;
 	if (!(m_sprites.find("Platform") == m_sprites.end()))
-		v_gameObjects.push_back(new gameObject({pos.x, pos.y}, m_sprites.at("Platform"), LAYER_PLATFORM, level_scale, GO_TYPE::GO_PLATFORM, true));
+		g_obj = level_arena_create<Platform>(AEVec2{pos.x, pos.y}, m_sprites.at("Platform"), level_scale, columns, rows);
 	else
-		v_gameObjects.push_back(new gameObject({pos.x, pos.y}, nullptr, LAYER_PLATFORM, level_scale, GO_TYPE::GO_PLATFORM, true));
+		g_obj = level_arena_create<Platform>(AEVec2{pos.x, pos.y}, nullptr, level_scale, columns, rows);
+	v_gameObjects.push_back(g_obj);
+	v_static_objects.push_back(g_obj);
 }
 
 /*!****************************************************************************
@@ -880,21 +913,30 @@ void Level::clear_area(s32 const area)
 	for (auto &a : *v_area_walls[area])
 	{
 		a->flag = false;
-		Color colors[2]{{0.3f, 0.3f, 0.3f, 0.6f}, {0.4f, 0.4f, 0.4f, 0.8f}};
-		AEVec2 scales[2]{{10.0f, 10.0f}, {30.0f, 30.0f}};
-		f32 lifetimes[2]{1, 3};
-		f32 rotations[2]{0, 2 * PI};
-		f32 directions[2]{0, 2 * PI};
-		f32 speeds[2]{100.0f, 300.0f};
-		particleSystem *pParticleSystem = new particleSystem(a, a->scale, false, 100U, 0.1f, 0.016f,
-															 0.0f, particle_default_behaviour, colors, lifetimes, scales, rotations, directions, speeds, nullptr);
+		particleSystem *pParticleSystem = create_particlesystem(a);
+		pParticleSystem->priority = PARTICLE_PRIORITY::AMBIENT;
+		pParticleSystem->color_range[0] = {0.3f, 0.3f, 0.3f, 0.6f};
+		pParticleSystem->color_range[1] = {0.4f, 0.4f, 0.4f, 0.8f};
+		pParticleSystem->scale_range[0] = {10.0f, 10.0f};
+		pParticleSystem->scale_range[1] = {30.0f, 30.0f};
+		pParticleSystem->lifetime_range[0] = 1;
+		pParticleSystem->lifetime_range[1] = 3;
+		pParticleSystem->rotation_range[0] = 0;
+		pParticleSystem->rotation_range[1] = 2 * PI;
+		pParticleSystem->direction_range[0] = 0;
+		pParticleSystem->direction_range[1] = 2 * PI;
+		pParticleSystem->speed_range[0] = 100.0f;
+		pParticleSystem->speed_range[1] = 300.0f;
+		pParticleSystem->scale = a->scale;
+		pParticleSystem->max_particles = 100;
+		pParticleSystem->lifetime = 0.1f;
 		pParticleSystem->particle_increment = 300;
 		pParticleSystem->set_aabb();
-		Level::v_gameObjects.push_back(pParticleSystem);
 	}
 	for (auto &a : *v_area_enemies[area])
 	{
-		a->flag = false;
+		if (gameObject *enemy = get_object(a))
+			destroy_object(enemy);
 	}
 	current_area++;
 	if (current_area < v_area_enemies.size())
@@ -902,8 +944,11 @@ void Level::clear_area(s32 const area)
 		level_cam.set_max_boundary(v_area_walls[current_area]->at(0)->curr_pos);
 		for (auto &a : *v_area_enemies[current_area])
 		{
-			a->flag = true;
-			a->game_object_initialize();
+			gameObject *enemy = get_object(a);
+			if (!enemy)
+				continue;
+			enemy->flag = true;
+			enemy->game_object_initialize();
 		}
 	}
 	else
@@ -958,24 +1003,53 @@ void Level::win_level()
 /*!****************************************************************************
  * @brief Update all the gameobjects in the specified vector and set its
  * AABB boundary for collision check
+ *
+ * Objects of the types in GO_SLEEP_MASK fall asleep once they are further
+ * than SLEEP_REGION_MARGIN from the camera view, and wake up once they are
+ * back within ACTIVE_REGION_MARGIN of it. Sleeping objects are not updated,
+ * collided or drawn, so the cost of a frame does not grow with the length of
+ * the level. Collisions and area transitions can also wake them, which keeps
+ * them awake for WAKE_DURATION wherever they are.
+ *
+ * Objects with a slot in the transform store, the pooled attack colliders
+ * and collectables, are integrated and bounded together by the store once
+ * every object has been updated.
  * 
  * @param v_obj 
  * Reference to the vector of gameobject pointers
 ******************************************************************************/
 void level_objects_update(std::vector<gameObject *> &v_obj)
 {
+	AABB active_region = Level::level_cam.get_view(ACTIVE_REGION_MARGIN);
+	AABB sleep_region = Level::level_cam.get_view(SLEEP_REGION_MARGIN);
+	AEVec2 still{ 0, 0 };
 	for (std::vector<gameObject *>::iterator i = v_obj.begin(); i != v_obj.end(); ++i)
 	{
 		if ((*i)->flag)
 		{
+			if ((*i)->wake_timer > 0.0f)
+			{
+				(*i)->wake_timer -= G_DELTATIME;
+			}
+			else if (GO_SLEEP_MASK & go_type_bit((*i)->type))
+			{
+				if ((*i)->is_asleep && !rtr_collide((*i)->bounding_box, still, active_region, still))
+					continue;
+				(*i)->is_asleep = !rtr_collide((*i)->bounding_box, still, sleep_region, still);
+				if ((*i)->is_asleep)
+					continue;
+			}
 			(*i)->game_object_update();
-			(*i)->set_aabb();
+			if (!transform_store_prepare(**i))
+				(*i)->set_aabb();
 		}
 	}
+	transform_store_integrate(G_DELTATIME);
 }
 
 /*!****************************************************************************
  * @brief Draw all the gameobjects in the specified vector if the flag is true
+ * and it is not asleep
  * 
  * @param v_obj 
  * Reference to the vector of gameobject pointers
@@ -984,7 +1058,7 @@ void objects_draw(std::vector<gameObject *> &v_obj)
 {
 	for (vector<gameObject *>::iterator go = v_obj.begin(); go != v_obj.end(); ++go)
 	{
-		if ((*go)->flag)
+		if ((*go)->flag && !(*go)->is_asleep)
 		{
 			(*go)->game_object_draw();
 		}
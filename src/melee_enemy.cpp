@@ -26,10 +26,10 @@ Technology is prohibited.
 ******************************************************************************/
 void MeleeEnemy2::game_object_load()
 {
-	Animation ani_first = Animation(1, { 0.0f, 0.0f }, obj_sprite, 125, 0.1f);
-	Animation ani_second = Animation(4, { 0.0f, 0.0f }, obj_sprite, 302, 0.1f);
-	Animation ani_third = Animation(2, { 0.0f, 280.5f }, obj_sprite, 302, 0.1f);
-	Animation ani_forth = Animation(1, { 302.5f, 280.5f }, obj_sprite, 302, 0.1f);
+	Animation ani_first = Animation(1, { 0.0f, 0.0f }, &render_state, 125, 0.1f);
+	Animation ani_second = Animation(4, { 0.0f, 0.0f }, &render_state, 302, 0.1f);
+	Animation ani_third = Animation(2, { 0.0f, 280.5f }, &render_state, 302, 0.1f);
+	Animation ani_forth = Animation(1, { 302.5f, 280.5f }, &render_state, 302, 0.1f);
 	animations.emplace_back(ani_first);
 	animations.emplace_back(ani_second);
 	animations.emplace_back(ani_third);
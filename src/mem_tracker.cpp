@@ -0,0 +1,342 @@
+/*!*************************************************************************
+****
+\file   mem_tracker.cpp
+\author agent
+\par    email: agent\@local
+\date   Oct 17 2026
+
+\brief
+This file contains the implementation of the memory tracker of the game
+engine.
+
+With MEM_TRACKING defined, the global operator new places a small header in
+front of each allocation holding its size and tag, so operator delete can
+take it off the counters of the tag that made it, whichever scope it is
+freed in. The game runs on one thread, so the counters are not atomic.
+
+The functions include:
+- tracked_alloc
+- tracked_free
+- operator new, operator new[] (and nothrow versions)
+- operator delete, operator delete[] (and sized and nothrow versions)
+- mem_tag_push
+- mem_tag_pop
+- mem_tracker_frame_start
+- mem_tracker_frame_end
+- mem_tracker_set_budget
+- mem_tracker_enforce_budgets
+- mem_tracker_budgets_enforced
+- mem_tracker_dump_csv
+- get_mem_tag_stats
+- get_mem_allocation_count
+- get_mem_tag_name
+
+Copyright (C) 2026 DigiPen Institure of Technology.
+Reproduction or disclosure of this file or its contents
+without the prior written consent of DigiPen Institute of
+Technology is prohibited.
+****************************************************************************
+***/
+#include "mem_tracker.h"
+#include <cstdlib>
+#include <fstream>
+#include <new>
+
+constexpr int MEM_TAG_COUNT = static_cast<int>(MEM_TAG::TOTAL);
+
+static const char* mem_tag_names[MEM_TAG_COUNT] = { "Other", "Level load", "Particles", "Attacks", "Audio", "UI" };
+
+// Allocations per frame allowed once budgets are enforced, 0 for no budget.
+// Gameplay should only allocate when something new is spawned, so these are
+// only meant to catch an allocation made for every object every frame.
+static Mem_Tag_Stats tag_stats[MEM_TAG_COUNT] =
+{
+	{ 0, 0, 0, 0, 0, 0 },	// OTHER
+	{ 0, 0, 0, 0, 0, 0 },	// LEVEL_LOAD
+	{ 0, 0, 0, 0, 0, 16 },	// PARTICLES
+	{ 0, 0, 0, 0, 0, 8 },	// ATTACKS
+	{ 0, 0, 0, 0, 0, 4 },	// AUDIO
+	{ 0, 0, 0, 0, 0, 0 }	// UI
+};
+static bool enforce_budgets = false;
+
+#ifdef MEM_TRACKING
+// Deepest nesting of scopes whose tags are kept, deeper scopes use the last kept tag
+constexpr u32 MEM_TAG_DEPTH = 16;
+// Keeps the memory after the header aligned as operator new requires
+constexpr size_t MEM_HEADER_SIZE = 16;
+
+struct Alloc_Header
+{
+	size_t size;
+	MEM_TAG tag;
+};
+static_assert(sizeof(Alloc_Header) <= MEM_HEADER_SIZE, "Allocation header does not fit!");
+
+static MEM_TAG tag_stack[MEM_TAG_DEPTH];
+static u32 tag_depth = 0;
+static u32 frame_counts[MEM_TAG_COUNT];
+
+/*!****************************************************************************
+ * @brief Allocates memory with a header, and counts it under the current tag
+ *
+ * @param size
+ * Bytes to allocate
+ * @return void*
+ * Memory after the header, or nullptr if out of memory
+******************************************************************************/
+static void* tracked_alloc(size_t size)
+{
+	if (!size)
+		size = 1;
+	char* memory = static_cast<char*>(std::malloc(size + MEM_HEADER_SIZE));
+	if (!memory)
+		return nullptr;
+
+	MEM_TAG tag = MEM_TAG::OTHER;
+	if (tag_depth)
+		tag = tag_stack[(tag_depth < MEM_TAG_DEPTH ? tag_depth : MEM_TAG_DEPTH) - 1];
+	Alloc_Header* header = reinterpret_cast<Alloc_Header*>(memory);
+	header->size = size;
+	header->tag = tag;
+
+	Mem_Tag_Stats& stats = tag_stats[static_cast<int>(tag)];
+	stats.live_bytes += size;
+	if (stats.live_bytes > stats.peak_bytes)
+		stats.peak_bytes = stats.live_bytes;
+	++stats.live_allocations;
+	++stats.total_allocations;
+	++frame_counts[static_cast<int>(tag)];
+	return memory + MEM_HEADER_SIZE;
+}
+
+/*!****************************************************************************
+ * @brief Frees memory from tracked_alloc, taking it off the counters of the
+ * tag it was allocated under
+ *
+ * @param ptr
+ * Memory to free, may be nullptr
+******************************************************************************/
+static void tracked_free(void* ptr)
+{
+	if (!ptr)
+		return;
+	char* memory = static_cast<char*>(ptr) - MEM_HEADER_SIZE;
+	const Alloc_Header* header = reinterpret_cast<const Alloc_Header*>(memory);
+	Mem_Tag_Stats& stats = tag_stats[static_cast<int>(header->tag)];
+	stats.live_bytes -= header->size;
+	--stats.live_allocations;
+	std::free(memory);
+}
+
+void* operator new(size_t size)
+{
+	void* memory = tracked_alloc(size);
+	if (!memory)
+		throw std::bad_alloc();
+	return memory;
+}
+
+void* operator new[](size_t size)
+{
+	void* memory = tracked_alloc(size);
+	if (!memory)
+		throw std::bad_alloc();
+	return memory;
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept
+{
+	return tracked_alloc(size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept
+{
+	return tracked_alloc(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+	tracked_free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+	tracked_free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept
+{
+	tracked_free(ptr);
+}
+
+void operator delete[](void* ptr, size_t) noexcept
+{
+	tracked_free(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept
+{
+	tracked_free(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept
+{
+	tracked_free(ptr);
+}
+
+/*!****************************************************************************
+ * @brief Tags the allocations made from now on, until the matching
+ * mem_tag_pop. Use a Mem_Scope instead of calling this directly.
+ *
+ * @param tag
+ * Tag of the subsystem
+******************************************************************************/
+void mem_tag_push(MEM_TAG tag)
+{
+	if (tag_depth < MEM_TAG_DEPTH)
+		tag_stack[tag_depth] = tag;
+	++tag_depth;
+}
+
+/*!****************************************************************************
+ * @brief Goes back to the tag before the last mem_tag_push
+******************************************************************************/
+void mem_tag_pop()
+{
+	if (tag_depth)
+		--tag_depth;
+}
+
+/*!****************************************************************************
+ * @brief Starts counting the allocations of a frame. Allocations made while
+ * loading and initializing a game state are not counted in any frame.
+******************************************************************************/
+void mem_tracker_frame_start()
+{
+	for (int i{ 0 }; i < MEM_TAG_COUNT; ++i)
+		frame_counts[i] = 0;
+}
+
+/*!****************************************************************************
+ * @brief Stores the allocations made this frame, and asserts if a tag went
+ * over its budget while budgets are enforced
+******************************************************************************/
+void mem_tracker_frame_end()
+{
+	for (int i{ 0 }; i < MEM_TAG_COUNT; ++i)
+	{
+		Mem_Tag_Stats& stats = tag_stats[i];
+		stats.frame_allocations = frame_counts[i];
+		if (enforce_budgets && stats.budget)
+		{
+			AE_ASSERT_MESG(stats.frame_allocations <= stats.budget, "%s made %u allocations in a frame, the budget is %u",
+				mem_tag_names[i], stats.frame_allocations, stats.budget);
+		}
+	}
+}
+#endif
+
+/*!****************************************************************************
+ * @brief Sets the most allocations a tag may make in a frame
+ *
+ * @param tag
+ * Tag of the subsystem
+ * @param allocations_per_frame
+ * Allocations allowed in a frame, 0 for no budget
+******************************************************************************/
+void mem_tracker_set_budget(MEM_TAG tag, u32 allocations_per_frame)
+{
+	tag_stats[static_cast<int>(tag)].budget = allocations_per_frame;
+}
+
+/*!****************************************************************************
+ * @brief Turns the budget asserts on or off
+ *
+ * @param enforce
+ * True to assert when a tag goes over its budget
+******************************************************************************/
+void mem_tracker_enforce_budgets(bool enforce)
+{
+	enforce_budgets = enforce;
+}
+
+/*!****************************************************************************
+ * @brief Checks if the budget asserts are on
+ *
+ * @return true
+ * Budgets are enforced
+ * @return false
+ * Budgets are not enforced
+******************************************************************************/
+bool mem_tracker_budgets_enforced()
+{
+	return enforce_budgets;
+}
+
+/*!****************************************************************************
+ * @brief Writes the counters of every tag to a CSV file, one row per tag
+ *
+ * @param path
+ * Path of the file, replaced if it exists
+ * @return true
+ * File written
+ * @return false
+ * File could not be opened
+******************************************************************************/
+bool mem_tracker_dump_csv(const char* path)
+{
+	std::ofstream out(path);
+	if (!out)
+		return false;
+	out << "tag,live_bytes,peak_bytes,live_allocations,total_allocations,frame_allocations,budget\n";
+	for (int i{ 0 }; i < MEM_TAG_COUNT; ++i)
+	{
+		const Mem_Tag_Stats& stats = tag_stats[i];
+		out << mem_tag_names[i] << ',' << stats.live_bytes << ',' << stats.peak_bytes << ','
+			<< stats.live_allocations << ',' << stats.total_allocations << ','
+			<< stats.frame_allocations << ',' << stats.budget << '\n';
+	}
+	return true;
+}
+
+/*!****************************************************************************
+ * @brief Gets the counters of a tag
+ *
+ * @param tag
+ * Tag of the subsystem
+ * @return const Mem_Tag_Stats&
+ * Counters of the tag, all 0 without MEM_TRACKING
+******************************************************************************/
+const Mem_Tag_Stats& get_mem_tag_stats(MEM_TAG tag)
+{
+	return tag_stats[static_cast<int>(tag)];
+}
+
+/*!****************************************************************************
+ * @brief Gets how many allocations were made under every tag. The difference
+ * between two calls is every allocation made in between.
+ *
+ * @return u32
+ * Allocations since the game started, 0 without MEM_TRACKING
+******************************************************************************/
+u32 get_mem_allocation_count()
+{
+	u32 count{ 0 };
+	for (const Mem_Tag_Stats& stats : tag_stats)
+		count += stats.total_allocations;
+	return count;
+}
+
+/*!****************************************************************************
+ * @brief Gets the name of a tag
+ *
+ * @param tag
+ * Tag of the subsystem
+ * @return const char*
+ * Name of the tag
+******************************************************************************/
+const char* get_mem_tag_name(MEM_TAG tag)
+{
+	return mem_tag_names[static_cast<int>(tag)];
+}
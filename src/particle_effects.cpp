@@ -1,4 +1,4 @@
-/*!*****************************************************************************
+﻿/*!*****************************************************************************
 \file   particle_effects.cpp
 \author Mohammad Hanif Koh Teck Wee
 \par    DP email: mohammadhanifkoh.t\@digipen.edu
@@ -6,7 +6,7 @@
 
 \brief
 This header file contains the implementation of functions to create commonly
-used particle systems, as well as all behavioural functions for particles.
+used particle systems, as well as the kernels of all behaviours of particles.
 
 The functions include:
 - create_falling_particles
@@ -30,6 +30,7 @@ without the prior written consent of DigiPen Institute of
 Technology is prohibited.
 *******************************************************************************/
 #include "particlesystem.h"
+#include "mem_tracker.h"
 
 /*!*****************************************************************************
   \brief
@@ -42,10 +43,12 @@ Technology is prohibited.
 *******************************************************************************/
 particleSystem* create_falling_particles()
 {
+	Mem_Scope mem_scope(MEM_TAG::PARTICLES);
 	AEVec2 camPos;
 	AEGfxGetCamPosition(&camPos.x, &camPos.y);
 	AEVec2 vParticleSystem = { camPos.x, camPos.y + static_cast<f32>(AEGetWindowHeight()) / 2 + 50.0f };
 	particleSystem* pParticleSystem = create_particlesystem(vParticleSystem);
+	pParticleSystem->priority = PARTICLE_PRIORITY::AMBIENT;
 	pParticleSystem->lifetime = 0.016f;
 	pParticleSystem->emission_rate = 0.016f;
 	pParticleSystem->max_particles = 50;
@@ -77,8 +80,9 @@ particleSystem* create_falling_particles()
 *******************************************************************************/
 particleSystem* create_dash_particles(gameObject* target)
 {
+	Mem_Scope mem_scope(MEM_TAG::PARTICLES);
 	particleSystem* pParticleSystem = create_particlesystem(target);
-	pParticleSystem->behaviour = dodge_particle;
+	pParticleSystem->kernel = dodge_particle;
 	pParticleSystem->lifetime = 0.25f;
 	pParticleSystem->emission_rate = 0.016f;
 	pParticleSystem->color_range[0] = { 1.0f, 1.4f, 0.0f, 0.6f };
@@ -109,6 +113,7 @@ particleSystem* create_dash_particles(gameObject* target)
 *******************************************************************************/
 particleSystem* create_damaged_particles(gameObject* target)
 {
+	Mem_Scope mem_scope(MEM_TAG::PARTICLES);
 	particleSystem* pParticleSystem = create_particlesystem(target);
 	pParticleSystem->lifetime = 0.1f;
 	pParticleSystem->lifetime_range[0] = pParticleSystem->lifetime_range[1] = 0.5f;
@@ -116,7 +121,7 @@ particleSystem* create_damaged_particles(gameObject* target)
 	pParticleSystem->scale_range[1] = { 10.0f, 10.0f };
 	pParticleSystem->speed_range[0] = 300.0f;
 	pParticleSystem->speed_range[1] = 500.0f;
-	pParticleSystem->behaviour = damage_taken;
+	pParticleSystem->kernel = damage_taken;
 	return pParticleSystem;
 }
 
@@ -135,6 +140,7 @@ particleSystem* create_damaged_particles(gameObject* target)
 *******************************************************************************/
 particleSystem* create_ground_particles(gameObject* target)
 {
+	Mem_Scope mem_scope(MEM_TAG::PARTICLES);
 	particleSystem* pParticleSystem = create_particlesystem(target);
 	pParticleSystem->lifetime = 0.016f;
 	pParticleSystem->emission_rate = 0.016f;
@@ -147,167 +153,86 @@ particleSystem* create_ground_particles(gameObject* target)
 	pParticleSystem->rotation_range[0] = 0;
 	pParticleSystem->rotation_range[0] = 2 * PI;
 	pParticleSystem->particle_increment = 10;
-	pParticleSystem->behaviour = slam_particle;
+	pParticleSystem->kernel = slam_particle;
 	pParticleSystem->set_aabb();
 	return pParticleSystem;
 }
 
+// Values of a kernel, in order: fade, fade_rate, grow, grow_rate,
+// random_grow_x, gravity, follow, seek
+
 /*!*****************************************************************************
   \brief
 	Particle behaviour for the spear throw particle effects. Particles increase
 	in size both horizontally and vertically, and slowly lose transparency.
 	Particle grows much faster vertically.
-
-  \param obj
-	a reference to each individual particle.
 *******************************************************************************/
-void spear_throw_particle(gameObject& obj)
-{
-	obj.scale.y += 2.0f;
-	obj.scale.x += 0.16f;
-	obj.obj_sprite->tint.a -= 0.05f;
-}
+const Particle_Kernel spear_throw_particle = { 0.05f, 0.0f, { 0.16f, 2.0f }, { 0.0f, 0.0f }, 0.0f, 0.0f, false, false };
 
 /*!*****************************************************************************
   \brief
 	Particle behaviour for dashing effects. Particles grow a random size
-	vertically, and slowly lose transparency.
-
-  \param obj
-	a reference to each individual particle.
+	horizontally, and slowly lose transparency.
 *******************************************************************************/
-void dodge_particle(gameObject& obj)
-{
-	obj.scale.x += G_DELTATIME * AERandFloat() * 100.0f;
-	obj.obj_sprite->tint.a -= 0.03f;
-}
+const Particle_Kernel dodge_particle = { 0.03f, 0.0f, { 0.0f, 0.0f }, { 0.0f, 0.0f }, 100.0f, 0.0f, false, false };
 
 /*!*****************************************************************************
   \brief
 	Particle behaviour for any floor-slamming related particle systems. A
 	downward force is added to the velocity of all particles every frame, and
 	particles slowly lose transparency.
-
-  \param obj
-	a reference to each individual particle.
 *******************************************************************************/
-void slam_particle(gameObject& obj)
-{
-	obj.curr_vel.y -= 500 * G_DELTATIME;
-	obj.obj_sprite->tint.a -= 0.01f;
-}
+const Particle_Kernel slam_particle = { 0.01f, 0.0f, { 0.0f, 0.0f }, { 0.0f, 0.0f }, 0.0f, 500.0f, false, false };
 
 /*!*****************************************************************************
   \brief
 	Particle behaviour for the spear charging animation. Particles move toward
 	the center of the particle system (adjusted to the tip of the spear), while
 	slowly getting smaller and losing transparency.
-
-  \param obj
-	a reference to each individual particle.
 *******************************************************************************/
-void spear_charge_particle(gameObject& obj)
-{
-	Particle* part = dynamic_cast<Particle*>(&obj);
-	AEVec2 dir = { part->parent->curr_pos.x - part->curr_pos.x, part->parent->curr_pos.y - part->curr_pos.y };
-	AEVec2Normalize(&dir, &dir);
-	AEVec2Scale(&obj.curr_vel, &dir, AEVec2Length(&obj.curr_vel));
-	obj.scale.x -= G_DELTATIME * 75.0f;
-	obj.scale.y -= G_DELTATIME * 75.0f;
-	obj.obj_sprite->tint.a -= 0.03f;
-}
+const Particle_Kernel spear_charge_particle = { 0.03f, 0.0f, { 0.0f, 0.0f }, { -75.0f, -75.0f }, 0.0f, 0.0f, false, true };
 
 /*!*****************************************************************************
   \brief
 	Default particle behaviour. Particles lose transparency very slowly over
 	time.
-
-  \param obj
-	a reference to each individual particle.
 *******************************************************************************/
-void particle_default_behaviour(gameObject& obj)
-{
-	obj.obj_sprite->tint.a -= 0.01f;
-}
+const Particle_Kernel particle_default_behaviour = { 0.01f, 0.0f, { 0.0f, 0.0f }, { 0.0f, 0.0f }, 0.0f, 0.0f, false, false };
 
 /*!*****************************************************************************
   \brief
 	Particle behaviour for damage taken particles. Particles lose transparency
 	over time.
-
-  \param obj
-	a reference to each individual particle.
 *******************************************************************************/
-void damage_taken(gameObject& obj)
-{
-	obj.obj_sprite->tint.a -= 0.05f;
-}
+const Particle_Kernel damage_taken = { 0.05f, 0.0f, { 0.0f, 0.0f }, { 0.0f, 0.0f }, 0.0f, 0.0f, false, false };
 
 /*!*****************************************************************************
   \brief
 	Particle behaviour for when boss gets vulnerable. Particles grow bigger and
 	lose transparency over time.
-
-  \param obj
-	a reference to each individual particle.
 *******************************************************************************/
-void boss_vulnerable(gameObject& obj)
-{
-	obj.obj_sprite->tint.a -= 0.02f;
-	obj.scale.x += 7;
-	obj.scale.y += 7;
-}
+const Particle_Kernel boss_vulnerable = { 0.02f, 0.0f, { 7.0f, 7.0f }, { 0.0f, 0.0f }, 0.0f, 0.0f, false, false };
 
 /*!*****************************************************************************
   \brief
 	Particle behaviour for Parry animation. Particles grow bigger and lose
 	transparency over time. Particle also follow the position of the particle
 	system (adjusted to be above the player).
-
-  \param obj
-	a reference to each individual particle.
 *******************************************************************************/
-void parry_particle(gameObject& obj)
-{
-	Particle* pParticle = dynamic_cast<Particle*>(&obj);
-	pParticle->curr_pos = pParticle->parent->curr_pos;
-	pParticle->scale.y += 30.0f * G_DELTATIME * 90;
-	pParticle->scale.x += 30.0f * G_DELTATIME * 90;
-	pParticle->obj_sprite->tint.a -= 0.03f * G_DELTATIME * 90;
-}
+const Particle_Kernel parry_particle = { 0.0f, 0.03f * 90, { 0.0f, 0.0f }, { 30.0f * 90, 30.0f * 90 }, 0.0f, 0.0f, true, false };
 
 /*!*****************************************************************************
   \brief
 	Particle behaviour for shockwave effects. Particles grow bigger over time.
 	Particle also follow the position of the particle system (adjusted to be
 	above the player).
-
-  \param obj
-	a reference to each individual particle.
 *******************************************************************************/
-void shockwave_particle(gameObject& obj)
-{
-	Particle* pParticle = dynamic_cast<Particle*>(&obj);
-	pParticle->curr_pos = pParticle->parent->curr_pos;
-	pParticle->scale.y += 30.0f * G_DELTATIME * 900;
-	pParticle->scale.x += 30.0f * G_DELTATIME * 900;
-	//pParticle->obj_sprite->tint.a -= 0.03f * G_DELTATIME * 90;
-}
+const Particle_Kernel shockwave_particle = { 0.0f, 0.0f, { 0.0f, 0.0f }, { 30.0f * 900, 30.0f * 900 }, 0.0f, 0.0f, true, false };
 
 /*!*****************************************************************************
   \brief
 	Particle behaviour for weapon changing  animation. Particles grow bigger and
 	lose transparency over time. Particle also follow the position of the
 	particle system (adjusted to be above the player).
-
-  \param obj
-	a reference to each individual particle.
 *******************************************************************************/
-void change_wep_particle(gameObject& obj)
-{
-	Particle* pParticle = dynamic_cast<Particle*>(&obj);
-	pParticle->curr_pos = pParticle->parent->curr_pos;
-	pParticle->scale.y += 2.0f;
-	pParticle->scale.x += 2.0f;
-	pParticle->obj_sprite->tint.a -= 0.05f;
-}
\ No newline at end of file
+const Particle_Kernel change_wep_particle = { 0.05f, 0.0f, { 2.0f, 2.0f }, { 0.0f, 0.0f }, 0.0f, 0.0f, true, false };
\ No newline at end of file
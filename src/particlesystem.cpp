@@ -1,4 +1,4 @@
-/*!*****************************************************************************
+﻿/*!*****************************************************************************
 \file   particlesystem.cpp
 \author Mohammad Hanif Koh Teck Wee
 \par    DP email: mohammadhanifkoh.t\@digipen.edu
@@ -9,16 +9,43 @@ This file contains the implementation of the particle system as outlined in
 particlesystem.h. It also contains static helper functions used in some of
 the particle system functions.
 
+Particles are updated by the kernel of their particle system, 4 at a time
+with SSE2 over the arrays of the pool. The particles left over at the end of
+the arrays are updated one at a time with the same arithmetic, so both paths
+give the same result for a particle.
+
+Every particle system shares one budget of live particles. As the budget
+fills up, particle systems emit fewer particles, starting with the least
+important ones, so many effects at once cannot slow the game down.
+
+Particle systems that are done are kept in a free list linked through the
+particle systems themselves, so creating an effect takes the first one
+without searching the vector of game objects or allocating.
+
 The functions include:
+- Particle_Pool::Particle_Pool
+- Particle_Pool::reserve
+- Particle_Pool::clear
+- Particle_Pool::remove
+- make_kernel_step
+- update_particle_range
+- update_particles
+- update_particles_scalar
+- get_emission_scale
 - Particle System constructors
+- Particle System destructor
+- particleSystem::reset
 - clear_particles
 - particle_system_load
 - particleSystem::game_object_update
-- Particle::game_object_update
 - particleSystem::game_object_draw
 - particle_system_unload
+- get_particle_stats
+- set_particle_budget
+- particle_benchmark
 - create_particle
 - delete_system
+- take_free_particlesystem
 - create_particlesystem
 
 Copyright (C) 2021 DigiPen Institure of Technology.
@@ -29,9 +56,378 @@ Technology is prohibited.
 #include "particleSystem.h"
 #include "attack.h"
 #include "level_manager.h"
+#include "mem_tracker.h"
+#include <cmath>
+#include <emmintrin.h>
 
 static AEGfxVertexList* pMeshParticles;
 static AEGfxTexture* pTexParticles;
+static Particle_Stats particle_stats;
+// Frame the particles updated so far were counted in
+static u32 stats_frame;
+static u32 updated_this_frame;
+// Bit i of a word is set if particle i died in the last update, kept between
+// frames so updating the particles does not allocate
+static vector<u32> dead_particles;
+static u32 particle_budget = PARTICLE_BUDGET;
+// First particle system that is done and can be reused, nullptr if none
+static particleSystem* free_particlesystems;
+
+// Share of the budget in use at which each priority starts emitting fewer
+// particles, and at which it stops emitting
+static const f32 priority_load[static_cast<int>(PARTICLE_PRIORITY::TOTAL)][2] =
+{
+	{ 0.3f, 0.6f },	// AMBIENT
+	{ 0.6f, 0.9f },	// EFFECT
+	{ 1.0f, 1.0f }	// ESSENTIAL, only stopped once the budget is full
+};
+
+// Values of a kernel for one update, worked out once for every particle
+struct Kernel_Step
+{
+	f32 dt;
+	f32 fade;
+	f32 grow_x;
+	f32 grow_y;
+	f32 random_grow_x;
+	f32 gravity;
+	AEVec2 center;
+	f32 max_distance_sq;	// 0 if particles are not culled by distance
+	bool follow;
+	bool seek;
+};
+
+/*!*****************************************************************************
+  \brief
+	Default constructor for particle pools. No memory is allocated until the
+	first particle is emitted.
+*******************************************************************************/
+Particle_Pool::Particle_Pool() : capacity{ 0 }, count{ 0 }, memory{}
+{
+}
+
+/*!*****************************************************************************
+  \brief
+	Makes room for a number of particles. The particles in use are kept.
+
+  \param new_capacity
+	The number of particles to make room for
+*******************************************************************************/
+void Particle_Pool::reserve(u32 new_capacity)
+{
+	if (new_capacity <= capacity)
+		return;
+	vector<f32> grown(static_cast<size_t>(new_capacity) * static_cast<u32>(PARTICLE_FIELD::TOTAL));
+	for (u32 i{ 0 }; i < static_cast<u32>(PARTICLE_FIELD::TOTAL); ++i)
+	{
+		const f32* old_values = field(static_cast<PARTICLE_FIELD>(i));
+		std::copy(old_values, old_values + count, grown.data() + i * new_capacity);
+	}
+	memory.swap(grown);
+	capacity = new_capacity;
+}
+
+/*!*****************************************************************************
+  \brief
+	Removes every particle. The memory is kept for the next particles.
+*******************************************************************************/
+void Particle_Pool::clear()
+{
+	count = 0;
+}
+
+/*!*****************************************************************************
+  \brief
+	Removes a particle by moving the last particle into its place.
+
+  \param index
+	The index of the particle to remove
+*******************************************************************************/
+void Particle_Pool::remove(u32 index)
+{
+	--count;
+	if (index == count)
+		return;
+	for (u32 i{ 0 }; i < static_cast<u32>(PARTICLE_FIELD::TOTAL); ++i)
+	{
+		f32* values = field(static_cast<PARTICLE_FIELD>(i));
+		values[index] = values[count];
+	}
+}
+
+/*!*****************************************************************************
+  \brief
+	Works out the values of a kernel for one update.
+
+  \param kernel
+	The kernel of the particle system
+
+  \param center
+	The position of the particle system
+
+  \param max_distance
+	The maximum distance of particles from where they were emitted, 0 for no
+	maximum
+
+  \param dt
+	The time since the last update
+
+  \return
+	The values of the kernel for the update.
+*******************************************************************************/
+static Kernel_Step make_kernel_step(const Particle_Kernel& kernel, AEVec2 center, f32 max_distance, f32 dt)
+{
+	Kernel_Step step;
+	step.dt = dt;
+	step.fade = kernel.fade + kernel.fade_rate * dt;
+	step.grow_x = kernel.grow.x + kernel.grow_rate.x * dt;
+	step.grow_y = kernel.grow.y + kernel.grow_rate.y * dt;
+	step.random_grow_x = kernel.random_grow_x * dt;
+	step.gravity = kernel.gravity * dt;
+	step.center = center;
+	step.max_distance_sq = max_distance > 0 ? max_distance * max_distance : 0;
+	step.follow = kernel.follow;
+	step.seek = kernel.seek;
+	return step;
+}
+
+/*!*****************************************************************************
+  \brief
+	Updates a range of particles one at a time, and marks the particles that
+	died.
+
+  \param particles
+	The particles to update
+
+  \param step
+	The values of the kernel for this update
+
+  \param first
+	The index of the first particle to update
+
+  \param last
+	The index after the last particle to update
+
+  \param dead
+	Bit i of dead[i / 32] is set if particle i died. Must have room for every
+	particle in the range.
+*******************************************************************************/
+static void update_particle_range(Particle_Pool& particles, const Kernel_Step& step, u32 first, u32 last, vector<u32>& dead)
+{
+	f32* pos_x = particles.pos_x();
+	f32* pos_y = particles.pos_y();
+	f32* vel_x = particles.vel_x();
+	f32* vel_y = particles.vel_y();
+	const f32* origin_x = particles.origin_x();
+	const f32* origin_y = particles.origin_y();
+	f32* scale_x = particles.scale_x();
+	f32* scale_y = particles.scale_y();
+	f32* life = particles.lifetime();
+	f32* alpha = particles.alpha();
+	for (u32 i{ first }; i < last; ++i)
+	{
+		if (step.follow)
+		{
+			pos_x[i] = step.center.x;
+			pos_y[i] = step.center.y;
+		}
+		if (step.seek)
+		{
+			f32 speed = std::sqrt(vel_x[i] * vel_x[i] + vel_y[i] * vel_y[i]);
+			f32 dx = step.center.x - pos_x[i];
+			f32 dy = step.center.y - pos_y[i];
+			f32 distance = std::sqrt(dx * dx + dy * dy);
+			// A particle already at the center keeps its velocity
+			if (distance > 0)
+			{
+				vel_x[i] = dx / distance * speed;
+				vel_y[i] = dy / distance * speed;
+			}
+		}
+		vel_y[i] -= step.gravity;
+		scale_x[i] += step.grow_x;
+		if (step.random_grow_x)
+			scale_x[i] += AERandFloat() * step.random_grow_x;
+		scale_y[i] += step.grow_y;
+		alpha[i] -= step.fade;
+
+		pos_x[i] += vel_x[i] * step.dt;
+		pos_y[i] += vel_y[i] * step.dt;
+		life[i] -= step.dt;
+
+		f32 dx = pos_x[i] - origin_x[i];
+		f32 dy = pos_y[i] - origin_y[i];
+		if (life[i] <= 0 || alpha[i] <= 0
+			|| (step.max_distance_sq > 0 && dx * dx + dy * dy > step.max_distance_sq))
+			dead[i / 32] |= 1u << (i % 32);
+	}
+}
+
+/*!*****************************************************************************
+  \brief
+	Moves, fades and ages every particle of a pool by the kernel of its
+	particle system, 4 particles at a time. Dead particles are marked but not
+	removed, so the caller can remove them afterwards.
+
+  \param particles
+	The particles to update
+
+  \param kernel
+	The kernel of the particle system
+
+  \param center
+	The position of the particle system
+
+  \param max_distance
+	The maximum distance of particles from where they were emitted, 0 for no
+	maximum
+
+  \param dt
+	The time since the last update
+
+  \param dead
+	Set so bit i of dead[i / 32] is set if particle i died
+*******************************************************************************/
+void update_particles(Particle_Pool& particles, const Particle_Kernel& kernel, AEVec2 center, f32 max_distance,
+	f32 dt, vector<u32>& dead)
+{
+	Kernel_Step step = make_kernel_step(kernel, center, max_distance, dt);
+	u32 count = particles.count;
+	dead.assign((count + 31) / 32, 0);
+
+	f32* pos_x = particles.pos_x();
+	f32* pos_y = particles.pos_y();
+	f32* vel_x = particles.vel_x();
+	f32* vel_y = particles.vel_y();
+	const f32* origin_x = particles.origin_x();
+	const f32* origin_y = particles.origin_y();
+	f32* scale_x = particles.scale_x();
+	f32* scale_y = particles.scale_y();
+	f32* life = particles.lifetime();
+	f32* alpha = particles.alpha();
+
+	__m128 zero = _mm_setzero_ps();
+	__m128 step_dt = _mm_set1_ps(step.dt);
+	__m128 fade = _mm_set1_ps(step.fade);
+	__m128 grow_x = _mm_set1_ps(step.grow_x);
+	__m128 grow_y = _mm_set1_ps(step.grow_y);
+	__m128 random_grow_x = _mm_set1_ps(step.random_grow_x);
+	__m128 gravity = _mm_set1_ps(step.gravity);
+	__m128 center_x = _mm_set1_ps(step.center.x);
+	__m128 center_y = _mm_set1_ps(step.center.y);
+	__m128 max_distance_sq = _mm_set1_ps(step.max_distance_sq);
+	__m128 cull = step.max_distance_sq > 0 ? _mm_castsi128_ps(_mm_set1_epi32(-1)) : zero;
+	u32 i{ 0 };
+	for (; i + 4 <= count; i += 4)
+	{
+		__m128 px = step.follow ? center_x : _mm_loadu_ps(&pos_x[i]);
+		__m128 py = step.follow ? center_y : _mm_loadu_ps(&pos_y[i]);
+		__m128 vx = _mm_loadu_ps(&vel_x[i]);
+		__m128 vy = _mm_loadu_ps(&vel_y[i]);
+		if (step.seek)
+		{
+			__m128 speed = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(vx, vx), _mm_mul_ps(vy, vy)));
+			__m128 dx = _mm_sub_ps(center_x, px);
+			__m128 dy = _mm_sub_ps(center_y, py);
+			__m128 distance = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)));
+			// Same as update_particle_range, particles at the center keep their velocity
+			__m128 away = _mm_cmpgt_ps(distance, zero);
+			vx = _mm_or_ps(_mm_and_ps(away, _mm_mul_ps(_mm_div_ps(dx, distance), speed)), _mm_andnot_ps(away, vx));
+			vy = _mm_or_ps(_mm_and_ps(away, _mm_mul_ps(_mm_div_ps(dy, distance), speed)), _mm_andnot_ps(away, vy));
+		}
+		vy = _mm_sub_ps(vy, gravity);
+		__m128 sx = _mm_add_ps(_mm_loadu_ps(&scale_x[i]), grow_x);
+		if (step.random_grow_x)
+		{
+			// Drawn in the same order as update_particle_range
+			f32 r0 = AERandFloat();
+			f32 r1 = AERandFloat();
+			f32 r2 = AERandFloat();
+			f32 r3 = AERandFloat();
+			sx = _mm_add_ps(sx, _mm_mul_ps(_mm_set_ps(r3, r2, r1, r0), random_grow_x));
+		}
+		__m128 sy = _mm_add_ps(_mm_loadu_ps(&scale_y[i]), grow_y);
+		__m128 a = _mm_sub_ps(_mm_loadu_ps(&alpha[i]), fade);
+
+		px = _mm_add_ps(px, _mm_mul_ps(vx, step_dt));
+		py = _mm_add_ps(py, _mm_mul_ps(vy, step_dt));
+		__m128 l = _mm_sub_ps(_mm_loadu_ps(&life[i]), step_dt);
+
+		_mm_storeu_ps(&pos_x[i], px);
+		_mm_storeu_ps(&pos_y[i], py);
+		_mm_storeu_ps(&vel_x[i], vx);
+		_mm_storeu_ps(&vel_y[i], vy);
+		_mm_storeu_ps(&scale_x[i], sx);
+		_mm_storeu_ps(&scale_y[i], sy);
+		_mm_storeu_ps(&alpha[i], a);
+		_mm_storeu_ps(&life[i], l);
+
+		__m128 dx = _mm_sub_ps(px, _mm_loadu_ps(&origin_x[i]));
+		__m128 dy = _mm_sub_ps(py, _mm_loadu_ps(&origin_y[i]));
+		__m128 distance_sq = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+		__m128 died = _mm_or_ps(
+			_mm_or_ps(_mm_cmple_ps(l, zero), _mm_cmple_ps(a, zero)),
+			_mm_and_ps(cull, _mm_cmpgt_ps(distance_sq, max_distance_sq)));
+		u32 mask = static_cast<u32>(_mm_movemask_ps(died));
+		dead[i / 32] |= mask << (i % 32);
+	}
+	update_particle_range(particles, step, i, count, dead);
+}
+
+/*!*****************************************************************************
+  \brief
+	Same as update_particles, but updates the particles one at a time. Used to
+	check and time update_particles.
+
+  \param particles
+	The particles to update
+
+  \param kernel
+	The kernel of the particle system
+
+  \param center
+	The position of the particle system
+
+  \param max_distance
+	The maximum distance of particles from where they were emitted, 0 for no
+	maximum
+
+  \param dt
+	The time since the last update
+
+  \param dead
+	Set so bit i of dead[i / 32] is set if particle i died
+*******************************************************************************/
+void update_particles_scalar(Particle_Pool& particles, const Particle_Kernel& kernel, AEVec2 center, f32 max_distance,
+	f32 dt, vector<u32>& dead)
+{
+	dead.assign((particles.count + 31) / 32, 0);
+	update_particle_range(particles, make_kernel_step(kernel, center, max_distance, dt), 0, particles.count, dead);
+}
+
+/*!*****************************************************************************
+  \brief
+	Gets how much of its emission a particle system may keep, given how full
+	the particle budget is.
+
+  \param priority
+	The priority of the particle system
+
+  \return
+	1 to emit every particle, down to 0 to emit none.
+*******************************************************************************/
+static f32 get_emission_scale(PARTICLE_PRIORITY priority)
+{
+	if (!particle_budget)
+		return 1.0f;
+	f32 load = static_cast<f32>(particle_stats.alive) / particle_budget;
+	const f32* range = priority_load[static_cast<int>(priority)];
+	if (load < range[0])
+		return 1.0f;
+	if (load >= range[1])
+		return 0.0f;
+	return (range[1] - load) / (range[1] - range[0]);
+}
 
 /*!*****************************************************************************
   \brief
@@ -59,9 +455,9 @@ static AEGfxTexture* pTexParticles;
 	The maximum distance each individual particle can be from the actual
 	particle system object before being destroyed.
 
-  \param behavior
-	The function pointer to the behavior of the particles. Can be left as a
-	nullptr if no special behaviour is required.
+  \param kernel
+	The behaviour of the particles. Can be left as {} if no special behaviour
+	is required.
 
   \param color_range[2]
 	An array of 2 colours, with the first element containing the minimum
@@ -92,14 +488,15 @@ static AEGfxTexture* pTexParticles;
 	Set as nullptr to draw the default mesh without any texture.
 *******************************************************************************/
 particleSystem::particleSystem(AEVec2 position, AEVec2 size, bool loop, u32 max_particles, f32 lifetime, f32 emission_rate,
-	f32 max_distance, fp behaviour, Color color_range[2], f32 lifetime_range[2],
+	f32 max_distance, const Particle_Kernel& kernel, Color color_range[2], f32 lifetime_range[2],
 	AEVec2 scale_range[2], f32 rotation_range[2], f32 direction_range[2],
 	f32 speed_range[2], AEGfxTexture* texture)
-	: gameObject{}, particle_increment{ 1 }, loop{ loop }, target{ nullptr }, position_offset{}, max_particles{ max_particles }, lifetime{ lifetime },
-	emission_rate{ emission_rate }, max_distance{ max_distance }, behaviour{ behaviour }, particles{},
+	: gameObject{}, particle_increment{ 1 }, loop{ loop }, target{ NULL_HANDLE }, position_offset{}, max_particles{ max_particles }, lifetime{ lifetime },
+	emission_rate{ emission_rate }, max_distance{ max_distance }, kernel(kernel), priority{ PARTICLE_PRIORITY::EFFECT },
+	emission_carry{ 0 }, particles{}, next_free{ nullptr },
 	color_range{ color_range[0], color_range[1] }, lifetime_range{ lifetime_range[0], lifetime_range[1] },
 	scale_range{ scale_range[0], scale_range[1] }, rotation_range{ rotation_range[0], rotation_range[1] }, timer{},
-	particle_count{}, direction_range{ direction_range[0], direction_range[1] }, speed_range{ speed_range[0], speed_range[1] }
+	direction_range{ direction_range[0], direction_range[1] }, speed_range{ speed_range[0], speed_range[1] }
 {
 	type = GO_TYPE::GO_PARTICLESYSTEM;
 	obj_sprite = new Sprite(texture, pMeshParticles);
@@ -133,9 +530,9 @@ particleSystem::particleSystem(AEVec2 position, AEVec2 size, bool loop, u32 max_
 	The maximum distance each individual particle can be from the actual
 	particle system object before being destroyed.
 
-  \param behavior
-	The function pointer to the behavior of the particles. Can be left as a
-	nullptr if no special behaviour is required.
+  \param kernel
+	The behaviour of the particles. Can be left as {} if no special behaviour
+	is required.
 
   \param color_range[2]
 	An array of 2 colours, with the first element containing the minimum
@@ -166,14 +563,15 @@ particleSystem::particleSystem(AEVec2 position, AEVec2 size, bool loop, u32 max_
 	Set as nullptr to draw the default mesh without any texture.
 *******************************************************************************/
 particleSystem::particleSystem(gameObject* target, AEVec2 size, bool loop, u32 max_particles, f32 lifetime, f32 emission_rate,
-	f32 max_distance, fp behaviour, Color color_range[2], f32 lifetime_range[2],
+	f32 max_distance, const Particle_Kernel& kernel, Color color_range[2], f32 lifetime_range[2],
 	AEVec2 scale_range[2], f32 rotation_range[2], f32 direction_range[2],
 	f32 speed_range[2], AEGfxTexture* texture)
-	: gameObject{}, particle_increment{ 1 }, loop{ loop }, target{ target }, position_offset{}, max_particles{ max_particles }, lifetime{ lifetime },
-	emission_rate{ emission_rate }, max_distance{ max_distance }, behaviour{ behaviour }, particles{},
+	: gameObject{}, particle_increment{ 1 }, loop{ loop }, target{ get_handle(target) }, position_offset{}, max_particles{ max_particles }, lifetime{ lifetime },
+	emission_rate{ emission_rate }, max_distance{ max_distance }, kernel(kernel), priority{ PARTICLE_PRIORITY::EFFECT },
+	emission_carry{ 0 }, particles{}, next_free{ nullptr },
 	color_range{ color_range[0], color_range[1] }, lifetime_range{ lifetime_range[0], lifetime_range[1] },
 	scale_range{ scale_range[0], scale_range[1] }, rotation_range{ rotation_range[0], rotation_range[1] }, timer{},
-	particle_count{}, direction_range{ direction_range[0], direction_range[1] }, speed_range{ speed_range[0], speed_range[1] }
+	direction_range{ direction_range[0], direction_range[1] }, speed_range{ speed_range[0], speed_range[1] }
 {
 	type = GO_TYPE::GO_PARTICLESYSTEM;
 	obj_sprite = new Sprite(texture, pMeshParticles);
@@ -183,18 +581,81 @@ particleSystem::particleSystem(gameObject* target, AEVec2 size, bool loop, u32 m
 
 /*!*****************************************************************************
   \brief
-	Clears all existing particles from within a particle system, and deallocates
-	all memory used by the particles.
+	Destructor for particle system objects. Deletes the sprite of the particle
+	system, which is kept while the particle system is in the free list.
+*******************************************************************************/
+particleSystem::~particleSystem()
+{
+	delete obj_sprite;
+}
+
+/*!*****************************************************************************
+  \brief
+	Resets a particle system in place, giving it the same values as the
+	constructors would. The sprite and the memory of the particles are kept,
+	so nothing is allocated. The particle system gets a new id, and handles to
+	it from before the reset stop resolving.
+
+  \param position
+	The position of the particle system. Not used if target is not a nullptr.
+
+  \param target
+	A pointer to the game object that the particle system should follow, or a
+	nullptr to stay at position.
+
+  \param size, loop, max_particles, lifetime, emission_rate, max_distance,
+  kernel, color_range, lifetime_range, scale_range, rotation_range,
+  direction_range, speed_range, texture
+	Same as the constructors.
+*******************************************************************************/
+void particleSystem::reset(AEVec2 position, gameObject* target, AEVec2 size, bool loop, u32 max_particles, f32 lifetime,
+	f32 emission_rate, f32 max_distance, const Particle_Kernel& kernel, Color color_range[2], f32 lifetime_range[2],
+	AEVec2 scale_range[2], f32 rotation_range[2], f32 direction_range[2],
+	f32 speed_range[2], AEGfxTexture* texture)
+{
+	Sprite* sprite = obj_sprite;
+	gameObject::reset();
+	type = GO_TYPE::GO_PARTICLESYSTEM;
+	obj_sprite = sprite;
+	*obj_sprite = Sprite(texture, pMeshParticles);
+	curr_pos = target ? target->curr_pos : position;
+	scale = size;
+
+	this->target = get_handle(target);
+	position_offset = {};
+	this->loop = loop;
+	this->max_particles = max_particles;
+	particle_increment = 1;
+	this->lifetime = lifetime;
+	timer = 0;
+	this->emission_rate = emission_rate;
+	this->max_distance = max_distance;
+	this->kernel = kernel;
+	priority = PARTICLE_PRIORITY::EFFECT;
+	emission_carry = 0;
+	particles.clear(); // already empty, particles are cleared when the system is done
+	for (int i{ 0 }; i < 2; ++i)
+	{
+		this->color_range[i] = color_range[i];
+		this->lifetime_range[i] = lifetime_range[i];
+		this->scale_range[i] = scale_range[i];
+		this->rotation_range[i] = rotation_range[i];
+		this->direction_range[i] = direction_range[i];
+		this->speed_range[i] = speed_range[i];
+	}
+	next_free = nullptr;
+}
+
+/*!*****************************************************************************
+  \brief
+	Clears all existing particles from within a particle system.
 
   \param pSystem
 	A reference to the particle system to be cleared.
 *******************************************************************************/
 void clear_particles(particleSystem& pSystem)
 {
-	for (Particle& pParticle : pSystem.particles)
-	{
-		delete pParticle.obj_sprite;
-	}
+	particle_stats.alive -= pSystem.particles.count;
 	pSystem.particles.clear();
 }
 
@@ -205,6 +666,9 @@ void clear_particles(particleSystem& pSystem)
 *******************************************************************************/
 void particle_system_load()
 {
+	particle_stats = {};
+	particle_stats.budget = particle_budget;
+	free_particlesystems = nullptr;
 	pMeshParticles = create_square_mesh(1.0f, 1.0f, 0xFFFFFFFF);
 	AE_ASSERT_MESG(pMeshParticles, "Failed to create mesh boss!");
 }
@@ -217,11 +681,13 @@ void particle_system_load()
 *******************************************************************************/
 void particleSystem::game_object_update()
 {
-	if (target)
+	Mem_Scope mem_scope(MEM_TAG::PARTICLES);
+	if (target.index != NO_HANDLE)
 	{
-		if (target->flag)
+		gameObject* followed = get_object(target);
+		if (followed && followed->flag)
 		{
-			AEVec2Add(&curr_pos, &target->curr_pos, &position_offset);
+			AEVec2Add(&curr_pos, &followed->curr_pos, &position_offset);
 		}
 
 		else
@@ -235,23 +701,53 @@ void particleSystem::game_object_update()
 
 	if (lifetime >= 0 && timer >= emission_rate)
 	{
+		// The wave is over even if every particle of it was throttled
+		timer = 0;
+		// Scaled down emissions keep the leftover part of a particle, so a
+		// particle system emitting 1 particle at a time still emits some
+		emission_carry += particle_increment * get_emission_scale(priority);
+		u32 increment = static_cast<u32>(emission_carry);
+		emission_carry -= increment;
 		for (u32 i{ 0 }; i < particle_increment; ++i)
-			if (particle_count < max_particles)
+			if (particles.count < max_particles)
 			{
-				create_particle();
+				if (i >= increment || (particle_budget && particle_stats.alive >= particle_budget))
+					++particle_stats.throttled;
+				else
+					create_particle();
 			}
 	}
 
-	for (Particle& pParticle : particles)
+	u32 frame = AEFrameRateControllerGetFrameCount();
+	if (frame != stats_frame)
 	{
-		if (pParticle.flag)
-			pParticle.game_object_update();
+		particle_stats.updated = updated_this_frame;
+		updated_this_frame = 0;
+		stats_frame = frame;
+	}
+	updated_this_frame += particles.count;
+
+	update_particles(particles, kernel, curr_pos, max_distance, G_DELTATIME, dead_particles);
+	// Removed from the back, so the last particle moved into a dead particle's
+	// place is always one that is still alive
+	for (u32 word{ static_cast<u32>(dead_particles.size()) }; word-- > 0;)
+	{
+		if (!dead_particles[word])
+			continue;
+		for (u32 bit{ 32 }; bit-- > 0;)
+		{
+			if (dead_particles[word] & (1u << bit))
+			{
+				particles.remove(word * 32 + bit);
+				--particle_stats.alive;
+			}
+		}
 	}
 
 	if (!loop)
 	{
 		lifetime -= G_DELTATIME;
-		if (lifetime <= 0 && !particle_count)
+		if (lifetime <= 0 && !particles.count)
 		{
 			this->delete_system();
 		}
@@ -260,59 +756,144 @@ void particleSystem::game_object_update()
 
 /*!*****************************************************************************
   \brief
-	Game Object Update function of Particle class. If any behaviour is set for
-	Particles, it is carried out here. The function then updates the position
-	of the particle and checks if the lifetime of the individual particle is
-	over.
+	Game Object Draw function of Particle Systems class. Draws every particle
+	with the texture and mesh of the particle system's sprite.
 *******************************************************************************/
-void Particle::game_object_update()
+void particleSystem::game_object_draw()
 {
-	if (behaviour)
+	Render_State state;
+	state.flip_x = obj_sprite->flip_x;
+	state.flip_y = obj_sprite->flip_y;
+	const f32* pos_x = particles.pos_x();
+	const f32* pos_y = particles.pos_y();
+	const f32* scale_x = particles.scale_x();
+	const f32* scale_y = particles.scale_y();
+	const f32* rot = particles.rot();
+	const f32* red = particles.red();
+	const f32* green = particles.green();
+	const f32* blue = particles.blue();
+	const f32* alpha = particles.alpha();
+	for (u32 i{ 0 }; i < particles.count; ++i)
 	{
-		behaviour(*this);
+		state.tint = { red[i], green[i], blue[i], alpha[i] };
+		state.rot = rot[i];
+		draw(*obj_sprite, state, { pos_x[i], pos_y[i] }, { scale_x[i], scale_y[i] });
 	}
+}
 
-	AEVec2 dt_vel;
-	AEVec2Scale(&dt_vel, &curr_vel, G_DELTATIME);
-	AEVec2Add(&curr_pos, &dt_vel, &curr_pos);
+/*!*****************************************************************************
+  \brief
+	Unloads all assets and deallocates all memory used by particle systems.
+	Called once in the unload functions of each level.
+*******************************************************************************/
+void particle_system_unload()
+{
+	// The particle systems are deleted with the rest of the game objects
+	free_particlesystems = nullptr;
+	AEGfxMeshFree(pMeshParticles);
+}
 
-	lifetime -= G_DELTATIME;
-	if (lifetime <= 0 || obj_sprite->tint.a <= 0
-		|| (max_distance && AEVec2Distance(&curr_pos, &initial_position) > max_distance))
-	{
-		flag = false;
-		--parent->particle_count;
-	}
+/*!*****************************************************************************
+  \brief
+	Gets the number of particles alive and updated, for profiling.
+
+  \return
+	The counters of the particles of every particle system.
+*******************************************************************************/
+const Particle_Stats& get_particle_stats()
+{
+	return particle_stats;
 }
 
 /*!*****************************************************************************
   \brief
-	Game Object Draw function of Particle Systems class. Iterates through the
-	vector of particles and draws each individual particle.
+	Sets the most particles alive at once across every particle system.
+
+  \param budget
+	The number of particles, 0 for no budget
 *******************************************************************************/
-void particleSystem::game_object_draw()
+void set_particle_budget(u32 budget)
 {
-	for (Particle& pParticle : particles)
-	{
-		pParticle.game_object_draw();
-	}
+	particle_budget = budget;
+	particle_stats.budget = budget;
 }
 
+#if defined(DEBUG) | defined(_DEBUG)
 /*!*****************************************************************************
   \brief
-	Unloads all assets and deallocates all memory used by particle systems.
-	Called once in the unload functions of each level.
+	Times update_particles_scalar against update_particles on random particles
+	using the slam kernel, with the particles culled by distance. Dead
+	particles are not removed, so every iteration updates every particle.
+
+  \param count
+	The number of particles to update
+
+  \param iterations
+	The number of times each path is run
+
+  \return
+	The time taken by each path and whether their results agree.
 *******************************************************************************/
-void particle_system_unload()
+Particle_Benchmark particle_benchmark(u32 count, u32 iterations)
 {
-	AEGfxMeshFree(pMeshParticles);
+	Particle_Pool scalar_particles;
+	scalar_particles.reserve(count);
+	scalar_particles.count = count;
+	for (u32 i{ 0 }; i < count; ++i)
+	{
+		scalar_particles.pos_x()[i] = scalar_particles.origin_x()[i] = AERandFloat() * 2560.0f;
+		scalar_particles.pos_y()[i] = scalar_particles.origin_y()[i] = AERandFloat() * 720.0f;
+		scalar_particles.vel_x()[i] = AERandFloat() * 1000.0f - 500.0f;
+		scalar_particles.vel_y()[i] = AERandFloat() * 1000.0f - 500.0f;
+		scalar_particles.scale_x()[i] = scalar_particles.scale_y()[i] = 20.0f;
+		scalar_particles.rot()[i] = 0;
+		scalar_particles.lifetime()[i] = 0.5f + AERandFloat() * 2.5f;
+		scalar_particles.red()[i] = scalar_particles.green()[i] = scalar_particles.blue()[i] = 1.0f;
+		scalar_particles.alpha()[i] = 1.0f;
+	}
+	Particle_Pool batch_particles = scalar_particles;
+
+	const f32 dt = 1.0f / 60.0f;
+	const f32 max_distance = 500.0f;
+	AEVec2 center{ 1280.0f, 360.0f };
+	vector<u32> scalar_dead;
+	vector<u32> batch_dead;
+	Particle_Benchmark result{ count, iterations, 0.0, 0.0, true };
+	f64 start, end;
+
+	AEGetTime(&start);
+	for (u32 n{ 0 }; n < iterations; ++n)
+	{
+		update_particles_scalar(scalar_particles, slam_particle, center, max_distance, dt, scalar_dead);
+	}
+	AEGetTime(&end);
+	result.scalar_time = end - start;
+
+	AEGetTime(&start);
+	for (u32 n{ 0 }; n < iterations; ++n)
+	{
+		update_particles(batch_particles, slam_particle, center, max_distance, dt, batch_dead);
+	}
+	AEGetTime(&end);
+	result.batch_time = end - start;
+
+	result.results_match = scalar_dead == batch_dead;
+	for (u32 i{ 0 }; i < static_cast<u32>(PARTICLE_FIELD::TOTAL); ++i)
+	{
+		const f32* scalar_values = scalar_particles.field(static_cast<PARTICLE_FIELD>(i));
+		const f32* batch_values = batch_particles.field(static_cast<PARTICLE_FIELD>(i));
+		if (!std::equal(scalar_values, scalar_values + count, batch_values))
+			result.results_match = false;
+	}
+	return result;
 }
+#endif
 
 /*!*****************************************************************************
   \brief
 	Creates a new particle. Randomizes a value for each data member of the new
-	particle based on the ranges set by the particle system. It then emplaces
-	the new particle into the particle system's vector of particles.
+	particle based on the ranges set by the particle system. It then writes the
+	new particle after the last particle of the particle system's pool.
 *******************************************************************************/
 void particleSystem::create_particle()
 {
@@ -335,70 +916,77 @@ void particleSystem::create_particle()
 	AEVec2FromAngle(&vel, direction);
 	AEVec2Scale(&vel, &vel, speed);
 
-	Particle pParticle = Particle();
-	pParticle.obj_sprite = new Sprite;
-	pParticle.obj_sprite->tint = color;
-	pParticle.obj_sprite->mesh = obj_sprite->mesh ? obj_sprite->mesh : pMeshParticles;
-	pParticle.obj_sprite->texture = obj_sprite->texture;
-	pParticle.obj_sprite->size = obj_sprite->size;
-	pParticle.obj_sprite->rot = rotation;
-	pParticle.obj_sprite->flip_x = obj_sprite->flip_x;
-	pParticle.obj_sprite->flip_y = obj_sprite->flip_y;
-	pParticle.initial_position.x = AERandFloat() * scale.x + bounding_box.min.x + position_offset.x;
-	pParticle.initial_position.y = AERandFloat() * scale.y + bounding_box.min.y + position_offset.y;
-	pParticle.curr_pos = pParticle.initial_position;
-	pParticle.curr_vel = vel;
-	pParticle.scale = { scale_x, scale_y };
-	pParticle.lifetime = lifespan;
-	pParticle.behaviour = behaviour;
-	pParticle.parent = this;
-	pParticle.max_distance = max_distance;
-	pParticle.type = GO_TYPE::GO_PARTICLE;
-
-	particles.emplace_back(pParticle);
-	++particle_count;
-	timer = 0;
+	// A particle without any lifetime would die before it is ever drawn
+	if (lifespan <= 0)
+		return;
+	if (!obj_sprite->mesh)
+		obj_sprite->mesh = pMeshParticles;
+
+	particles.reserve(max_particles);
+	if (particles.count == particles.capacity)
+		return;
+	u32 index = particles.count++;
+
+	f32 origin_x = AERandFloat() * scale.x + bounding_box.min.x + position_offset.x;
+	f32 origin_y = AERandFloat() * scale.y + bounding_box.min.y + position_offset.y;
+	particles.pos_x()[index] = particles.origin_x()[index] = origin_x;
+	particles.pos_y()[index] = particles.origin_y()[index] = origin_y;
+	particles.vel_x()[index] = vel.x;
+	particles.vel_y()[index] = vel.y;
+	particles.scale_x()[index] = scale_x;
+	particles.scale_y()[index] = scale_y;
+	particles.rot()[index] = rotation;
+	particles.lifetime()[index] = lifespan;
+	particles.red()[index] = color.r;
+	particles.green()[index] = color.g;
+	particles.blue()[index] = color.b;
+	particles.alpha()[index] = color.a;
+
+	++particle_stats.emitted;
+	++particle_stats.alive;
+	particle_stats.peak = AEMax(particle_stats.peak, particle_stats.alive);
 }
 
 /*!*****************************************************************************
   \brief
-	Clears all particles, deallocates memory of the sprite of the particle
-	system, and sets the particle system to be inactive.
+	Clears all particles, sets the particle system to be inactive, and puts it
+	in the free list to be reused. Does nothing if the particle system is
+	already inactive.
 *******************************************************************************/
 void particleSystem::delete_system()
 {
+	if (!flag)
+		return;
 	clear_particles(*this);
-	delete obj_sprite;
 	flag = false;
+	next_free = free_particlesystems;
+	free_particlesystems = this;
 }
 
 /*!*****************************************************************************
   \brief
-	Searches for an existing particle system in the vector of game objects to be
-	reused. Returns a nullptr if nothing is found.
-
-  \param v_gameObj
-	A pointer to the vector of game objects
+	Takes the first particle system off the free list. Returns a nullptr if
+	every particle system is in use.
 
   \return
-	A pointer to the particle system found.
+	A pointer to the particle system taken.
 *******************************************************************************/
-gameObject* get_particlesystem(vector<gameObject*>* v_gameObj)
+static particleSystem* take_free_particlesystem()
 {
-	for (gameObject* i : *v_gameObj)
+	particleSystem* pParticleSystem = free_particlesystems;
+	if (pParticleSystem)
 	{
-		if (i->type == GO_TYPE::GO_PARTICLESYSTEM && i->flag == false) return i;
+		free_particlesystems = pParticleSystem->next_free;
+		++particle_stats.reused;
 	}
-	return nullptr;
+	return pParticleSystem;
 }
 
 /*!*****************************************************************************
   \brief
 	Creates a default particle system that will follow the game object inputted
-	by the user. First it searches for any inactive particle systems in the
-	vector of game objects. If one exists, it will overwrite the existing
-	inactive particle system. If there are no existing inactive particle
-	systems, it will then create a new particle system and push it into the
+	by the user. If a particle system is in the free list, it is reset in place
+	and reused. Otherwise, a new particle system is created and pushed into the
 	vector of game objects.
 
   \param target
@@ -409,16 +997,17 @@ gameObject* get_particlesystem(vector<gameObject*>* v_gameObj)
 *******************************************************************************/
 particleSystem* create_particlesystem(gameObject* target)
 {
+	Mem_Scope mem_scope(MEM_TAG::PARTICLES);
 	Color colors[2]{ { 1.0f, 1.0f, 1.0f, 1.0f }, {1.0f, 1.0f, 1.0f, 1.0f } };
 	AEVec2 scales[2]{ {20.0f, 20.0f}, {20.0f, 20.0f} };
 	f32 lifetimes[2]{ 1.0f, 1.0f };
 	f32 rotations[2]{ 0, 0 };
 	f32 directions[2]{ 0, PI };
 	f32 speeds[2]{ 300.0f, 600.0f };
-	particleSystem* pParticleSystem = dynamic_cast<particleSystem*>(get_particlesystem(&Level::v_gameObjects));
+	particleSystem* pParticleSystem = take_free_particlesystem();
 	if (pParticleSystem)
 	{
-		*pParticleSystem = { target, { 0, 0 }, false, 10U, 5.0f, 0.016f, 0.0f, particle_default_behaviour, colors, lifetimes, scales, rotations, directions, speeds, nullptr };
+		pParticleSystem->reset({ 0, 0 }, target, { 0, 0 }, false, 10U, 5.0f, 0.016f, 0.0f, particle_default_behaviour, colors, lifetimes, scales, rotations, directions, speeds, nullptr);
 		pParticleSystem->set_aabb();
 	}
 	else
@@ -426,6 +1015,7 @@ particleSystem* create_particlesystem(gameObject* target)
 		pParticleSystem = new particleSystem{ target, { 0, 0 }, false, 10U, 5.0f, 0.016f, 0.0f, particle_default_behaviour, colors, lifetimes, scales, rotations, directions, speeds, nullptr };
 		pParticleSystem->set_aabb();
 		Level::v_gameObjects.emplace_back(pParticleSystem);
+		++particle_stats.systems;
 	}
 	return pParticleSystem;
 }
@@ -433,10 +1023,9 @@ particleSystem* create_particlesystem(gameObject* target)
 /*!*****************************************************************************
   \brief
 	Creates a default particle system at the position inputted by the user.
-	First it searches for any inactive particle systems in the vector of game
-	objects. If one exists, it will overwrite the existing inactive particle
-	system. If there are no existing inactive particle systems, it will then
-	create a new particle system and push it into the vector of game objects.
+	If a particle system is in the free list, it is reset in place and reused.
+	Otherwise, a new particle system is created and pushed into the vector of
+	game objects.
 
   \param target
 	The position of the particle system
@@ -446,16 +1035,17 @@ particleSystem* create_particlesystem(gameObject* target)
 *******************************************************************************/
 particleSystem* create_particlesystem(AEVec2 target)
 {
+	Mem_Scope mem_scope(MEM_TAG::PARTICLES);
 	Color colors[2]{ { 1.0f, 1.0f, 1.0f, 1.0f }, {1.0f, 1.0f, 1.0f, 1.0f } };
 	AEVec2 scales[2]{ {20.0f, 20.0f}, {20.0f, 20.0f} };
 	f32 lifetimes[2]{ 1.0f, 1.0f };
 	f32 rotations[2]{ 0, 0 };
 	f32 directions[2]{ 0, PI };
 	f32 speeds[2]{ 300.0f, 600.0f };
-	particleSystem* pParticleSystem = dynamic_cast<particleSystem*>(get_particlesystem(&Level::v_gameObjects));
+	particleSystem* pParticleSystem = take_free_particlesystem();
 	if (pParticleSystem)
 	{
-		*pParticleSystem = { target, { 0, 0 }, false, 10U, 5.0f, 0.016f, 0.0f, particle_default_behaviour, colors, lifetimes, scales, rotations, directions, speeds, nullptr };
+		pParticleSystem->reset(target, nullptr, { 0, 0 }, false, 10U, 5.0f, 0.016f, 0.0f, particle_default_behaviour, colors, lifetimes, scales, rotations, directions, speeds, nullptr);
 		pParticleSystem->set_aabb();
 	}
 	else
@@ -463,6 +1053,7 @@ particleSystem* create_particlesystem(AEVec2 target)
 		pParticleSystem = new particleSystem{ target, { 0, 0 }, false, 10U, 5.0f, 0.016f, 0.0f, particle_default_behaviour, colors, lifetimes, scales, rotations, directions, speeds, nullptr };
 		pParticleSystem->set_aabb();
 		Level::v_gameObjects.push_back(pParticleSystem);
+		++particle_stats.systems;
 	}
 	return pParticleSystem;
 }
\ No newline at end of file
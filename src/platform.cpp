@@ -0,0 +1,65 @@
+/*!*************************************************************************
+****
+\file   platform.cpp
+\author agent
+\par    email: agent\@local
+\date   Oct 17 2026
+
+\brief
+This file includes the implementation of the platforms of a level.
+
+The functions include:
+- Platform::Platform
+- Platform::game_object_draw
+
+Copyright (C) 2026 DigiPen Institure of Technology.
+Reproduction or disclosure of this file or its contents
+without the prior written consent of DigiPen Institute of
+Technology is prohibited.
+****************************************************************************
+***/
+#include "main.h"
+#include "platform.h"
+
+/*!****************************************************************************
+ * @brief Construct a new Platform object covering columns by rows tiles.
+ * The scale of the game object is the size of the whole block so that it
+ * collides as a single box.
+ *
+ * @param pos
+ * Centre of the block
+ * @param sprite
+ * Sprite of a single tile
+ * @param tile_scale
+ * Size of a single tile
+ * @param columns
+ * Number of tiles along x
+ * @param rows
+ * Number of tiles along y
+******************************************************************************/
+Platform::Platform(AEVec2 pos, Sprite* sprite, AEVec2 tile_scale, s32 columns, s32 rows)
+	: gameObject(pos, sprite, LAYER_PLATFORM, { tile_scale.x * columns, tile_scale.y * rows }, GO_TYPE::GO_PLATFORM, true),
+	tile_scale{ tile_scale }, columns{ columns }, rows{ rows }
+{
+}
+
+/*!****************************************************************************
+ * @brief Draws every tile of the platform, so that the block looks the same
+ * as separate tiles.
+ *
+******************************************************************************/
+void Platform::game_object_draw()
+{
+	if (!flag)
+		return;
+	AEVec2 pos;
+	for (s32 i{ 0 }; i < columns; ++i)
+	{
+		for (s32 j{ 0 }; j < rows; ++j)
+		{
+			pos = { curr_pos.x + (i + 0.5f - columns * 0.5f) * tile_scale.x,
+				curr_pos.y + (j + 0.5f - rows * 0.5f) * tile_scale.y };
+			draw(obj_sprite, pos, tile_scale);
+		}
+	}
+}
@@ -25,11 +25,9 @@ The functions include:
 	- hearts
 	- h_healths
 	- change_weapon
-	- clear_ignore_colliders
 	- setup_attack
 	- combo
 	- move
-	- adjust_player_movement
 	- start_invul
 	- invul
 	- take_damage
@@ -53,6 +51,8 @@ Technology is prohibited.
 #include "game_states.h"
 #include "particlesystem.h"
 #include "level_manager.h"
+#include "contact.h"
+#include "mem_tracker.h"
 
 constexpr f32 P_VEL_MOVEMENT = 500.0f;
 constexpr f32 P_JUMP_FORCE = 1100.0f;
@@ -451,8 +451,6 @@ void Player::game_object_free()
 	spear_attacks.clear();
 	sword_attacks.~vector();
 	spear_attacks.~vector();
-	ignorecolliders.clear();
-	ignorecolliders.~vector();
 }
 
 /*!
@@ -555,7 +553,7 @@ void Player::change_weapon()
 			pParticleSystem->position_offset.y += 75.0f;
 			pParticleSystem->scale = { 1, 1 };
 			pParticleSystem->max_particles = 1;
-			pParticleSystem->behaviour = change_wep_particle;
+			pParticleSystem->kernel = change_wep_particle;
 			pParticleSystem->obj_sprite->texture = curr_weapon ? pTex_Sword_Icon : pTex_Spear_Icon;
 			pParticleSystem->color_range[0] = { 1.0f, 1.0f, 1.0f, 1.0f };
 			pParticleSystem->color_range[1] = { 1.0f, 1.0f, 1.0f, 1.0f };
@@ -599,36 +597,11 @@ void Player::change_weapon()
 	}
 }
 
-/*!*****************************************************************************
-  \brief
-	Clears the ignore_colliders vector of all active enemies within the current
-	area. Called in between each attack so that enemies will take damage from
-	the incoming attack
-*******************************************************************************/
-void clear_ignore_colliders()
-{
-	if (Level::boss->flag)
-	{
-		Level::boss->ignorecolliders.clear();
-	}
-
-	else if (Level::pLevel->enemy_counter)
-	{
-		for (Enemy* pEnemy : *Level::v_area_enemies[Level::pLevel->current_area])
-		{
-			if (pEnemy->flag)
-			{
-				pEnemy->ignorecolliders.clear();
-			}
-		}
-	}
-}
-
 /*!*****************************************************************************
   \brief
 	Sets up the new attack the player is using by pushing an attack_collider
-	into the vector of game objects, clearing the ignore_colliders vector in
-	the active enemies and also setting the values of certain variables in the
+	into the vector of game objects, starting a new generation of hits so that
+	enemies will take damage from the incoming attack, and also setting the values of certain variables in the
 	player according to the attack being used.
 
   \param pAtk
@@ -637,7 +610,7 @@ void clear_ignore_colliders()
 void Player::setup_attack(Player_Attack* pAtk)
 {
 	push_object(GO_TYPE::GO_PLAYERATTACKCOLLIDER, this);
-	clear_ignore_colliders();
+	contact_next_generation();
 	curr_attack = pAtk;
 	attack_setup = true;
 	state = curr_attack->state;
@@ -889,7 +862,10 @@ void Player::combo()
 	}
 
 	if (curr_attack && curr_attack->attack)
+	{
+		Mem_Scope mem_scope(MEM_TAG::ATTACKS);
 		curr_attack->attack(*this);
+	}
 
 	if (attack_timer > 0)
 	{
@@ -1052,75 +1028,6 @@ void Player::move()
 	}
 }
 
-/*!
- * \brief Adjust the player's movement based on which side it is colliding to
- * If obj is a wall, push the player by the horizontal depth.
- *
- * If the player is near the top and velocity is going downwards, the player
- * will be forced on the ground, disabling airdash, zeroing the velocity and
- * remove attack colliders
- *
- * \param plyr
- * Reference to the game object representing the player
- * \param obj
- * Reference to the game object representing the collided object
- */
-void adjust_player_movement(gameObject& plyr, const gameObject& obj)
-{
-	Player* player = dynamic_cast<Player*>(&plyr);
-	AEVec2 player_currentpos = player->curr_pos;
-	AEVec2 diff_pos = obj.curr_pos;
-	AEVec2Sub(&diff_pos, &player->curr_pos, &diff_pos);
-
-	f32 player_width = (player->bounding_box.max.x - player->bounding_box.min.x) / 2;
-	f32 player_hh = (player->bounding_box.max.y - player->bounding_box.min.y) / 2;
-	f32 obj_halfscale_x = (obj.bounding_box.max.x - obj.bounding_box.min.x) / 2;
-	f32 obj_halfscale_y = (obj.bounding_box.max.y - obj.bounding_box.min.y) / 2;
-
-	f32 min_distx = player_width + obj_halfscale_x;
-	f32 min_disty = player_hh + obj_halfscale_y;
-
-	f32 depth_x = min_distx - fabs(diff_pos.x);
-
-	f32 depth_y = min_disty - fabs(diff_pos.y);
-	if (depth_x != 0 && depth_y != 0)
-	{
-		if (obj.type == GO_TYPE::GO_WALL && fabs(depth_x) < fabs(depth_y))
-		{
-			player->curr_pos.x += diff_pos.x < 0 ? -depth_x : +depth_x;
-		}
-		if (fabs(depth_y) < fabs(depth_x))
-		{
-			if (diff_pos.y > 0 && fabs(depth_y) <= 30.0f)
-			{
-				player->curr_pos.y += depth_y;
-				player->curr_vel.y = 0;
-				player->on_ground = true;
-				player->airdashed = false;
-				switch (player->state)
-				{
-				case P_Anim_State::P_SWORD_JUMP:
-				case P_Anim_State::P_SWORD_JUMP_ATK:
-					player->state = P_Anim_State::P_SWORD_IDLE;
-					remove_attack_collider(player);
-					break;
-				case P_Anim_State::P_SPEAR_JUMP_ATK:
-				case P_Anim_State::P_SPEAR_JUMP:
-					player->state = P_Anim_State::P_SPEAR_IDLE;
-					remove_attack_collider(player);
-					break;
-				}
-			}
-		}
-	}
-	else if (!depth_y && diff_pos.y > 0)
-	{
-		player->curr_vel.y = 0;
-		player->airdashed = false;
-		player->on_ground = true;
-	}
-}
-
 /*!
  * \brief Sets in_vul to true
  *
@@ -1191,11 +1098,11 @@ void Player::take_damage(s32 damage)
 
 /*!
  * \brief Collision function for the player.
+ * The player has already been pushed out of platforms and walls by
+ * resolve_bodies. If it landed, airdash is enabled again and any jump attack
+ * is ended along with its attack collider.
+ *
  * Iterate through all the colliders in the player.
- * If the collider is a platform or a destructable and the player is not on
- * ground, check if the player is moving downwards and then adjust player
- * movement.
- * Same goes for the wall but did not need to dot product.
  *
  * If the object type is a monster, check for the default enemy. If the type is
  * the default enemy, check collision with player and enemy inner bound and then
@@ -1213,35 +1120,36 @@ void Player::take_damage(s32 damage)
  */
 void player_collide(gameObject& obj)
 {
-	Player* player = dynamic_cast<Player*>(&obj);
-	player->on_ground = false;
-	vector<gameObject*>& colliders = obj.colliders;
-	for (vector<gameObject*>::iterator i = colliders.begin(); i != colliders.end(); ++i)
+	Player* player = go_cast<Player>(&obj);
+	if (player->on_ground)
 	{
-		gameObject& obj_col = **i;
-		if ((obj_col.type == GO_TYPE::GO_PLATFORM || obj_col.type == GO_TYPE::GO_DESTRUCTABLE) && !player->on_ground)
-		{
-			AEVec2 e1{ 0, 1 };
-			if (AEVec2DotProduct(&player->curr_vel, &e1) < 0)
-			{
-				adjust_player_movement(obj, obj_col);
-			}
-		}
-
-		else if (obj_col.type == GO_TYPE::GO_WALL)
+		player->airdashed = false;
+		switch (player->state)
 		{
-			adjust_player_movement(obj, obj_col);
+		case P_Anim_State::P_SWORD_JUMP:
+		case P_Anim_State::P_SWORD_JUMP_ATK:
+			player->state = P_Anim_State::P_SWORD_IDLE;
+			remove_attack_collider(player);
+			break;
+		case P_Anim_State::P_SPEAR_JUMP_ATK:
+		case P_Anim_State::P_SPEAR_JUMP:
+			player->state = P_Anim_State::P_SPEAR_IDLE;
+			remove_attack_collider(player);
+			break;
 		}
+	}
 
-		else if (obj_col.type == GO_TYPE::GO_MONSTER)
+	Collider_List& colliders = obj.colliders;
+	for (Collider_List::iterator i = colliders.begin(); i != colliders.end(); ++i)
+	{
+		gameObject& obj_col = **i;
+		if (obj_col.type == GO_TYPE::GO_MONSTER)
 		{
-			if (dynamic_cast<RangedEnemy*>(&obj_col))
-				continue;
-
-			if (dynamic_cast<MeleeEnemy2*>(&obj_col))
+			// Only the slimes hurt the player on touch
+			Enemy* enemy = go_cast<Enemy>(&obj_col);
+			if (enemy->enemy_type != ENEMY_TYPE::ENEMY_SLIME)
 				continue;
 
-			Enemy* enemy = dynamic_cast<Enemy*>(&obj_col);
 			if (!player->is_invul && rtr_collide(player->bounding_box, player->curr_vel, enemy->innerBound, enemy->curr_vel))
 			{
 				AEVec2 push = { 200, 300 };
@@ -1293,7 +1201,7 @@ void player_collide(gameObject& obj)
 				{
 					player->curr_vel.y = 0;
 				}
-				Attack_Collider* collider = dynamic_cast<Attack_Collider*>(&obj_col);
+				Attack_Collider* collider = go_cast<Attack_Collider>(&obj_col);
 				if (collider->damage)
 				{
 					if (player->shield_timer)
@@ -1320,7 +1228,7 @@ void player_collide(gameObject& obj)
 		{
 			if (!player->is_invul)
 			{
-				Attack_Collider* collider = dynamic_cast<Attack_Collider*>(&obj_col);
+				Attack_Collider* collider = go_cast<Attack_Collider>(&obj_col);
 				player->take_damage(collider->damage);
 				if (collider->owner)
 				{
@@ -1331,24 +1239,26 @@ void player_collide(gameObject& obj)
 
 		else if (obj_col.type == GO_TYPE::GO_COLLECTABLES)
 		{
-			if (player->health == PLAYER_HEALTH)
+			Collectable* collectable = go_cast<Collectable>(&obj_col);
+			if (collectable->collectable_type == COLLECTABLE_TYPE::HEART)
 			{
-				if (heart_shake_interval <= 0.0f)
+				if (player->health == PLAYER_HEALTH)
 				{
-					heart_shake_timer = 0.5f;
-					heart_shake_interval = 2.0f;
+					if (heart_shake_interval <= 0.0f)
+					{
+						heart_shake_timer = 0.5f;
+						heart_shake_interval = 2.0f;
+					}
+					continue;
 				}
-				continue;
+				player->health = static_cast<s32>(AEClamp(static_cast<f32>(player->health + 2), 0, PLAYER_HEALTH));
 			}
-
-			player->health = static_cast<s32>(AEClamp(static_cast<f32>(player->health + 2), 0, PLAYER_HEALTH));
-			Heart::pick_up_sound->play_sound();
-			obj_col.flag = false;
+			collectable_pick_up(*collectable);
 		}
 
 		else if (obj_col.type == GO_TYPE::GO_TRAPS)
 		{
-			Traps* traps = dynamic_cast<Traps*>(&obj_col);
+			Traps* traps = go_cast<Traps>(&obj_col);
 
 			if (traps->traps_type == TRAPS_TYPE::TRAPS_KILLZONE)
 			{
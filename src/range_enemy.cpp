@@ -38,13 +38,13 @@ RangedEnemy::RangedEnemy() : Enemy(), range{ 1 }
  * Position of enemy to spawn
  * @param scale 
  * Scale of the enemy
- * @param spr 
- * Sprite pointer for the enemy. It should be a unique allocated sprite.
+ * @param asset 
+ * Sprite asset of the enemy, shared with the other enemies using it
  * @param range 
  * Range for the attack
 ******************************************************************************/
-RangedEnemy::RangedEnemy(s32 health, AEVec2 init_pos, AEVec2 scale, Sprite* spr, f32 range)
-	: Enemy(health, init_pos, scale, spr), range{ range }
+RangedEnemy::RangedEnemy(s32 health, AEVec2 init_pos, AEVec2 scale, const Sprite_Asset* asset, f32 range)
+	: Enemy(health, init_pos, scale, asset), range{ range }
 {
 	enemy_type = ENEMY_TYPE::ENEMY_SKELETON_RANGED;
 }
@@ -55,9 +55,9 @@ RangedEnemy::RangedEnemy(s32 health, AEVec2 init_pos, AEVec2 scale, Sprite* spr,
 ******************************************************************************/
 void RangedEnemy::game_object_load()
 {
-	Animation ani_first = Animation(1, { 0.0f, 0.0f }, obj_sprite, 125, 0.1f);
-	Animation ani_second = Animation(3, { 0.0f, 0.0f }, obj_sprite, 125, 0.1f);
-	Animation ani_third = Animation(1, { 375.0f, 0.0f }, obj_sprite, 125, 0.1f);
+	Animation ani_first = Animation(1, { 0.0f, 0.0f }, &render_state, 125, 0.1f);
+	Animation ani_second = Animation(3, { 0.0f, 0.0f }, &render_state, 125, 0.1f);
+	Animation ani_third = Animation(1, { 375.0f, 0.0f }, &render_state, 125, 0.1f);
 	animations.emplace_back(ani_first);
 	animations.emplace_back(ani_second);
 	animations.emplace_back(ani_third);
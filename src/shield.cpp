@@ -64,7 +64,7 @@ void shield_parry_response(gameObject& obj)
 	pParticleSystem->lifetime = .3f;
 	pParticleSystem->scale = { 1, 1 };
 	pParticleSystem->max_particles = 1;
-	pParticleSystem->behaviour = parry_particle;
+	pParticleSystem->kernel = parry_particle;
 	pParticleSystem->obj_sprite->texture = pTex_circle;
 	pParticleSystem->color_range[0] = pParticleSystem->color_range[1] = { 1.0f, 1.0f, 1.0f, 0.8f };
 	pParticleSystem->lifetime_range[0] = pParticleSystem->lifetime_range[1] = 5.0f;
@@ -75,11 +75,12 @@ void shield_parry_response(gameObject& obj)
 	pParticleSystem->emission_rate = .03f;
 
 	particleSystem* button_prompt = create_particlesystem(&obj);
+	button_prompt->priority = PARTICLE_PRIORITY::ESSENTIAL;
 	button_prompt->lifetime = .3f;
 	button_prompt->position_offset.y += 30.0f;
 	button_prompt->scale = { 1, 1 };
 	button_prompt->max_particles = 1;
-	button_prompt->behaviour = damage_taken;
+	button_prompt->kernel = damage_taken;
 	button_prompt->obj_sprite->texture = pTex_z_button;
 	button_prompt->obj_sprite->mesh = z_button_mesh;
 	button_prompt->obj_sprite->size = button_size;
@@ -171,10 +172,10 @@ void shield_unload()
 ******************************************************************************/
 void shield_collide(gameObject& obj)
 {
-	Attack_Collider* collider = dynamic_cast<Attack_Collider*>(&obj);
-	Player* player = dynamic_cast<Player*>(collider->owner);
-	vector<gameObject*>& colliders = obj.colliders;
-	for (vector<gameObject*>::iterator i = colliders.begin(); i != colliders.end(); ++i)
+	Attack_Collider* collider = go_cast<Attack_Collider>(&obj);
+	Player* player = go_cast<Player>(collider->owner);
+	Collider_List& colliders = obj.colliders;
+	for (Collider_List::iterator i = colliders.begin(); i != colliders.end(); ++i)
 	{
 		gameObject& obj_col = **i;
 		if (obj_col.type == GO_TYPE::GO_ENEMYATTACKCOLLIDER || obj_col.type == GO_TYPE::GO_BOSSATTACKCOLLIDER)
@@ -192,7 +193,7 @@ void shield_collide(gameObject& obj)
 				player->parry = false;
 			if (obj_col.type == GO_TYPE::GO_ENEMYATTACKCOLLIDER)
 			{
-				Attack_Collider* collider = dynamic_cast<Attack_Collider*>(&obj_col);
+				Attack_Collider* collider = go_cast<Attack_Collider>(&obj_col);
 				if (collider->owner)
 				{
 					obj_col.flag = false;
@@ -201,8 +202,8 @@ void shield_collide(gameObject& obj)
 		}
 		if (obj_col.type == GO_TYPE::GO_MONSTER)
 		{
-			Enemy* mob = dynamic_cast<Enemy*>(&obj_col);
-			if (!dynamic_cast<RangedEnemy*>(mob))
+			Enemy* mob = go_cast<Enemy>(&obj_col);
+			if (mob->enemy_type != ENEMY_TYPE::ENEMY_SKELETON_RANGED)
 			{
 				if (rtr_collide(obj.bounding_box, obj.curr_vel, mob->innerBound, mob->curr_vel))
 				{
@@ -239,7 +240,7 @@ void shield_collide(gameObject& obj)
 void shield_up(gameObject& gameObj)
 {
 	static f32 translate_x, translate_y;
-	Player* player = dynamic_cast<Player*> (&gameObj);
+	Player* player = go_cast<Player>(&gameObj);
 	if (!player) return;
 
 	Attack_Collider* collider = get_attack_collider(player);
@@ -300,7 +301,7 @@ void shield_up(gameObject& gameObj)
 ******************************************************************************/
 void parry_attack(gameObject& gameObj)
 {
-	Player* player = dynamic_cast<Player*> (&gameObj);
+	Player* player = go_cast<Player>(&gameObj);
 	if (!player) return;
 	player->start_invul();
 	Attack_Collider* collider = get_attack_collider(player);
@@ -337,7 +338,7 @@ void parry_attack(gameObject& gameObj)
 			pParticleSystem->lifetime = .3f;
 			pParticleSystem->scale = { 1, 1 };
 			pParticleSystem->max_particles = 1;
-			pParticleSystem->behaviour = shockwave_particle;
+			pParticleSystem->kernel = shockwave_particle;
 			pParticleSystem->obj_sprite->texture = pTex_shockwave;
 			pParticleSystem->color_range[0] = { 1.0f, 1.0f, 1.0f, 0.5f };
 			pParticleSystem->color_range[1] = { 1.0f, 1.0f, 1.0f, 0.5f };
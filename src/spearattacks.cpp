@@ -34,6 +34,7 @@ Technology is prohibited.
 #include "audio.h"
 #include "player.h"
 #include "level_manager.h"
+#include "contact.h"
 
 static constexpr f32 BLEED_DURATION = 5.0f;
 static constexpr f32 BLEED_TICK = 1.0f;
@@ -88,8 +89,6 @@ static void spear_attack_collide(gameObject &gameObj);
 static void proc_bleed(Enemy &enemy);
 static void proc_bleed(Boss &boss);
 static void bleed_particle(gameObject *obj);
-void spear_charge_particle(gameObject &obj);
-void spear_throw_particle(gameObject &obj);
 
 /******************************************************************************
  * @brief 
@@ -206,7 +205,7 @@ static void bleed_particle(gameObject *obj)
 	pParticleSystem->position_offset.y += 75.0f;
 	pParticleSystem->scale = {1, 1};
 	pParticleSystem->max_particles = 1;
-	pParticleSystem->behaviour = change_wep_particle;
+	pParticleSystem->kernel = change_wep_particle;
 	pParticleSystem->obj_sprite->texture = pTex_bleed_proc;
 	pParticleSystem->color_range[0] = {1.0f, 1.0f, 1.0f, 1.0f};
 	pParticleSystem->color_range[1] = {1.0f, 1.0f, 1.0f, 1.0f};
@@ -255,8 +254,7 @@ static void proc_bleed(Boss &boss)
 /****************************************************************************** 
  * \brief Collision function of the spear
  * Iterates through all the colliders of the spear collider. On collide with 
- * an enemy and boss, pushback the enemy pointer to the spear collider's 
- * ignorecolliders and play the spear_stab sound.
+ * an enemy and boss for the first time, play the spear_stab sound.
  * If the player's spear upgrade is >= 2, there will be a chance to activate 
  * the bleed to the enemy or boss. If the spear_hold_duration is >= 
  * CHARGED_SPEAR_TIME, bleed effect will activate regardless of chance.
@@ -266,22 +264,21 @@ static void proc_bleed(Boss &boss)
 ******************************************************************************/
 static void spear_attack_collide(gameObject &gameObj)
 {
-	Attack_Collider *collider = dynamic_cast<Attack_Collider *>(&gameObj);
-	Player *player = dynamic_cast<Player *>(collider->owner);
-	vector<gameObject *> &colliders = collider->colliders;
-	for (vector<gameObject *>::iterator i = colliders.begin(); i != colliders.end(); ++i)
+	Attack_Collider *collider = go_cast<Attack_Collider>(&gameObj);
+	Player *player = go_cast<Player>(collider->owner);
+	Collider_List &colliders = collider->colliders;
+	for (Collider_List::iterator i = colliders.begin(); i != colliders.end(); ++i)
 	{
 		gameObject &obj_col = **i;
 		if (obj_col.type == GO_TYPE::GO_MONSTER || obj_col.type == GO_TYPE::GO_BOSS)
 		{
 			if (obj_col.type == GO_TYPE::GO_MONSTER)
 			{
-				Enemy *enemy = dynamic_cast<Enemy *>(&obj_col);
+				Enemy *enemy = go_cast<Enemy>(&obj_col);
 				if (rtr_collide(collider->bounding_box, collider->curr_vel, enemy->innerBound, enemy->curr_vel))
 				{
-					if (std::find(collider->ignorecolliders.begin(), collider->ignorecolliders.end(), enemy) == collider->ignorecolliders.end())
+					if (contact_first_hit(*collider, *enemy))
 					{
-						collider->ignorecolliders.push_back(enemy);
 						if (player->spear_upgrade >= 2)
 						{
 							if (AERandFloat() <= BLEED_PROC_CHANCE || spear_hold_duration >= CHARGED_SPEAR_TIME)
@@ -293,10 +290,9 @@ static void spear_attack_collide(gameObject &gameObj)
 			}
 			else
 			{
-				Boss *boss = dynamic_cast<Boss *>(&obj_col);
-				if (std::find(collider->ignorecolliders.begin(), collider->ignorecolliders.end(), boss) == collider->ignorecolliders.end())
+				Boss *boss = go_cast<Boss>(&obj_col);
+				if (contact_first_hit(*collider, *boss))
 				{
-					collider->ignorecolliders.push_back(boss);
 					if (player->spear_upgrade >= 2)
 					{
 						if (AERandFloat() <= BLEED_PROC_CHANCE || spear_hold_duration >= CHARGED_SPEAR_TIME)
@@ -318,22 +314,21 @@ static void spear_attack_collide(gameObject &gameObj)
 ******************************************************************************/
 static void spear_collide(gameObject &gameObj)
 {
-	Attack_Collider *collider = dynamic_cast<Attack_Collider *>(&gameObj);
-	Player *player = dynamic_cast<Player *>(collider->owner);
-	vector<gameObject *> &colliders = collider->colliders;
-	for (vector<gameObject *>::iterator i = colliders.begin(); i != colliders.end(); ++i)
+	Attack_Collider *collider = go_cast<Attack_Collider>(&gameObj);
+	Player *player = go_cast<Player>(collider->owner);
+	Collider_List &colliders = collider->colliders;
+	for (Collider_List::iterator i = colliders.begin(); i != colliders.end(); ++i)
 	{
 		gameObject &obj_col = **i;
 		if (obj_col.type == GO_TYPE::GO_MONSTER || obj_col.type == GO_TYPE::GO_BOSS)
 		{
 			if (obj_col.type == GO_TYPE::GO_MONSTER)
 			{
-				Enemy *enemy = dynamic_cast<Enemy *>(&obj_col);
+				Enemy *enemy = go_cast<Enemy>(&obj_col);
 				if (rtr_collide(collider->bounding_box, collider->curr_vel, enemy->innerBound, enemy->curr_vel))
 				{
-					if (std::find(collider->ignorecolliders.begin(), collider->ignorecolliders.end(), enemy) == collider->ignorecolliders.end())
+					if (contact_first_hit(*collider, *enemy))
 					{
-						collider->ignorecolliders.push_back(enemy);
 						if (player->spear_upgrade >= 2)
 						{
 							if (AERandFloat() <= BLEED_PROC_CHANCE || spear_hold_duration >= CHARGED_SPEAR_TIME)
@@ -347,10 +342,9 @@ static void spear_collide(gameObject &gameObj)
 			}
 			else
 			{
-				Boss *boss = dynamic_cast<Boss *>(&obj_col);
-				if (std::find(collider->ignorecolliders.begin(), collider->ignorecolliders.end(), boss) == collider->ignorecolliders.end())
+				Boss *boss = go_cast<Boss>(&obj_col);
+				if (contact_first_hit(*collider, *boss))
 				{
-					collider->ignorecolliders.push_back(boss);
 					if (player->spear_upgrade >= 2)
 					{
 						if (AERandFloat() <= BLEED_PROC_CHANCE || spear_hold_duration >= CHARGED_SPEAR_TIME)
@@ -376,7 +370,7 @@ static void spear_collide(gameObject &gameObj)
 void spear_attack_1(gameObject &gameObj)
 {
 	static f32 translate_x, translate_y;
-	Player *player = dynamic_cast<Player *>(&gameObj);
+	Player *player = go_cast<Player>(&gameObj);
 	if (!player)
 		return;
 
@@ -436,7 +430,7 @@ void spear_attack_1(gameObject &gameObj)
 void spear_attack_2(gameObject &gameObj)
 {
 	static f32 translate_x, translate_y;
-	Player *player = dynamic_cast<Player *>(&gameObj);
+	Player *player = go_cast<Player>(&gameObj);
 	if (!player)
 		return;
 
@@ -491,7 +485,7 @@ void spear_attack_2(gameObject &gameObj)
 void spear_dodge(gameObject &gameObj)
 {
 	static f32 translate_x;
-	Player *player = dynamic_cast<Player *>(&gameObj);
+	Player *player = go_cast<Player>(&gameObj);
 	if (!player)
 		return;
 
@@ -529,7 +523,7 @@ void spear_dodge(gameObject &gameObj)
 void spear_attack_3(gameObject &gameObj)
 {
 	static f32 translate_x, translate_y;
-	Player *player = dynamic_cast<Player *>(&gameObj);
+	Player *player = go_cast<Player>(&gameObj);
 	if (!player)
 		return;
 
@@ -590,7 +584,7 @@ void spear_attack_3(gameObject &gameObj)
 void spear_attack_4(gameObject &gameObj)
 {
 	static f32 translate_x, translate_y;
-	Player *player = dynamic_cast<Player *>(&gameObj);
+	Player *player = go_cast<Player>(&gameObj);
 	if (!player)
 		return;
 
@@ -648,7 +642,7 @@ void spear_attack_5(gameObject &gameObj)
 {
 	static f32 translate_x, translate_y;
 	static bool leaped;
-	Player *player = dynamic_cast<Player *>(&gameObj);
+	Player *player = go_cast<Player>(&gameObj);
 	if (!player)
 		return;
 
@@ -714,7 +708,7 @@ void spear_attack_5(gameObject &gameObj)
 ***************************************************************************/
 void spear_jump_attack(gameObject &gameObj)
 {
-	Player *player = dynamic_cast<Player *>(&gameObj);
+	Player *player = go_cast<Player>(&gameObj);
 	if (!player)
 		return;
 	if (player->state != Spear_Jump_Atk.state)
@@ -763,7 +757,7 @@ void spear_jump_attack(gameObject &gameObj)
 ***************************************************************************/
 void spear_plunge(gameObject &gameObj)
 {
-	Player *player = dynamic_cast<Player *>(&gameObj);
+	Player *player = go_cast<Player>(&gameObj);
 	if (!player)
 		return;
 	if (player->state != Spear_Plunge_Atk.state)
@@ -807,7 +801,7 @@ void spear_plunge(gameObject &gameObj)
 		if (!collider->flag)
 		{
 			particleSystem *pParticleSystem = create_particlesystem(player);
-			pParticleSystem->behaviour = slam_particle;
+			pParticleSystem->kernel = slam_particle;
 			pParticleSystem->obj_sprite->texture = pTex_dust;
 			pParticleSystem->lifetime = 0.25f;
 			pParticleSystem->emission_rate = 0.02f;
@@ -862,7 +856,7 @@ void spear_plunge(gameObject &gameObj)
 ***************************************************************************/
 void spear_throw(gameObject &gameObj)
 {
-	Player *player = dynamic_cast<Player *>(&gameObj);
+	Player *player = go_cast<Player>(&gameObj);
 	static particleSystem *charge_particle;
 	static bool spear_thrown;
 	static bool super_power;
@@ -883,7 +877,8 @@ void spear_throw(gameObject &gameObj)
 		attack_over = false;
 		charge_level = 1;
 		charge_particle = create_particlesystem(player);
-		charge_particle->behaviour = spear_charge_particle;
+		charge_particle->kernel = spear_charge_particle;
+		charge_particle->priority = PARTICLE_PRIORITY::ESSENTIAL;
 		charge_particle->lifetime = 0.25f;
 		charge_particle->obj_sprite->texture = pTex_grey_circle;
 		charge_particle->emission_rate = 0.036f;
@@ -975,7 +970,7 @@ void spear_throw(gameObject &gameObj)
 			{
 				particleSystem *pParticleSystem = create_particlesystem(collider);
 				pParticleSystem->lifetime = 2.0f;
-				pParticleSystem->behaviour = spear_throw_particle;
+				pParticleSystem->kernel = spear_throw_particle;
 				pParticleSystem->obj_sprite->texture = pTex_grey_circle;
 				pParticleSystem->color_range[0] = {1.0f, 1.0f, 1.0f, 1.0f};
 				pParticleSystem->color_range[1] = {1.0f, 1.0f, 1.0f, 1.0f};
@@ -1002,7 +997,7 @@ void spear_throw(gameObject &gameObj)
 			{
 				particleSystem *pParticleSystem = create_particlesystem(collider);
 				pParticleSystem->lifetime = 5.1f;
-				pParticleSystem->behaviour = spear_throw_particle;
+				pParticleSystem->kernel = spear_throw_particle;
 				pParticleSystem->obj_sprite->texture = pTex_grey_circle;
 				pParticleSystem->color_range[0] = {1.0f, 1.0f, 1.0f, 1.0f};
 				pParticleSystem->color_range[1] = {1.0f, 1.0f, 1.0f, 1.0f};
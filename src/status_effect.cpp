@@ -83,8 +83,8 @@ namespace Status_Effect
 	 *************************************************************************/
 	void bleed(gameObject& obj)
 	{
-		Enemy* enemy = dynamic_cast<Enemy*>(&obj);
-		Boss* boss = dynamic_cast<Boss*>(&obj);
+		Enemy* enemy = go_cast<Enemy>(&obj);
+		Boss* boss = go_cast<Boss>(&obj);
 		if (boss)
 		{
 			boss->take_damage(BLEED_DMG);
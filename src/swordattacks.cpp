@@ -35,6 +35,7 @@ Technology is prohibited.
 #include "player.h"
 #include "camera.h"
 #include "level_manager.h"
+#include "contact.h"
 
 static constexpr f32 UPGRADED_MULTIPLIER = 2.0f;
 
@@ -140,8 +141,7 @@ void sword_unload()
 /******************************************************************************
  * @brief Collision function of the sword
  * Iterates through all the colliders of the sword collider. On collide with 
- * an enemy and boss, pushback the enemy pointer to the sword collider's 
- * ignorecolliders and play the sword_hit_sound. Perform additional check for 
+ * an enemy and boss for the first time, play the sword_hit_sound. Perform additional check for 
  * the enemy as the initial collision is on the enemy's outer bound hence 
  * another collision check is required for collision between the inner bound 
  * and the sword collider.
@@ -152,40 +152,38 @@ void sword_unload()
 ******************************************************************************/
 void sword_collide(gameObject &gameObj)
 {
-	Attack_Collider *collider = dynamic_cast<Attack_Collider *>(&gameObj);
-	Player *player = dynamic_cast<Player *>(collider->owner);
+	Attack_Collider *collider = go_cast<Attack_Collider>(&gameObj);
+	Player *player = go_cast<Player>(collider->owner);
 
-	vector<gameObject *> &colliders = collider->colliders;
-	for (vector<gameObject *>::iterator i = colliders.begin(); i != colliders.end(); ++i)
+	Collider_List &colliders = collider->colliders;
+	for (Collider_List::iterator i = colliders.begin(); i != colliders.end(); ++i)
 	{
 		gameObject &obj_col = **i;
 		if (obj_col.type == GO_TYPE::GO_MONSTER || obj_col.type == GO_TYPE::GO_BOSS)
 		{
 			if (obj_col.type == GO_TYPE::GO_MONSTER)
 			{
-				Enemy *enemy = dynamic_cast<Enemy *>(&obj_col);
+				Enemy *enemy = go_cast<Enemy>(&obj_col);
 				if (rtr_collide(collider->bounding_box, collider->curr_vel, enemy->innerBound, enemy->curr_vel))
 				{
-					if (std::find(collider->ignorecolliders.begin(), collider->ignorecolliders.end(), enemy) == collider->ignorecolliders.end())
+					if (contact_first_hit(*collider, *enemy))
 					{
-						collider->ignorecolliders.push_back(enemy);
 						sword_hit_sound->play_sound();
 					}
 				}
 			}
 			else
 			{
-				Boss *boss = dynamic_cast<Boss *>(&obj_col);
-				if (std::find(collider->ignorecolliders.begin(), collider->ignorecolliders.end(), boss) == collider->ignorecolliders.end())
+				Boss *boss = go_cast<Boss>(&obj_col);
+				if (contact_first_hit(*collider, *boss))
 				{
-					collider->ignorecolliders.push_back(boss);
 					sword_hit_sound->play_sound();
 				}
 			}
 		}
 		if (obj_col.type == GO_TYPE::GO_ENEMYATTACKCOLLIDER)
 		{
-			Attack_Collider *collider = dynamic_cast<Attack_Collider *>(&obj_col);
+			Attack_Collider *collider = go_cast<Attack_Collider>(&obj_col);
 			if (collider->owner)
 			{
 				obj_col.flag = false;
@@ -212,7 +210,7 @@ void sword_collide(gameObject &gameObj)
 ***/
 void sword_attack_1(gameObject &gameObj)
 {
-	Player *player = dynamic_cast<Player *>(&gameObj);
+	Player *player = go_cast<Player>(&gameObj);
 	if (!player)
 		return;
 
@@ -259,7 +257,7 @@ void sword_attack_1(gameObject &gameObj)
 ***************************************************************************/
 void sword_attack_2(gameObject &gameObj)
 {
-	Player *player = dynamic_cast<Player *>(&gameObj);
+	Player *player = go_cast<Player>(&gameObj);
 	if (!player)
 		return;
 
@@ -307,7 +305,7 @@ void sword_attack_2(gameObject &gameObj)
 void sword_attack_3(gameObject &gameObj)
 {
 	static f32 translate_x, translate_y;
-	Player *player = dynamic_cast<Player *>(&gameObj);
+	Player *player = go_cast<Player>(&gameObj);
 	if (!player)
 		return;
 
@@ -379,7 +377,7 @@ void sword_attack_3(gameObject &gameObj)
 ***************************************************************************/
 void sword_attack_4(gameObject &gameObj)
 {
-	Player *player = dynamic_cast<Player *>(&gameObj);
+	Player *player = go_cast<Player>(&gameObj);
 	if (!player)
 		return;
 	static bool part_1, landed;
@@ -433,7 +431,7 @@ void sword_attack_4(gameObject &gameObj)
 		if (!landed)
 		{
 			particleSystem *pParticleSystem = create_particlesystem(player);
-			pParticleSystem->behaviour = slam_particle;
+			pParticleSystem->kernel = slam_particle;
 			pParticleSystem->obj_sprite->texture = pTex_dust;
 			pParticleSystem->lifetime = 0.25f;
 			pParticleSystem->emission_rate = 0.02f;
@@ -484,7 +482,7 @@ void sword_attack_4(gameObject &gameObj)
 void sword_attack_5(gameObject &gameObj)
 {
 	static f32 translate_x, translate_y;
-	Player *player = dynamic_cast<Player *>(&gameObj);
+	Player *player = go_cast<Player>(&gameObj);
 	if (!player)
 		return;
 
@@ -561,7 +559,7 @@ void sword_attack_5(gameObject &gameObj)
 void sword_attack_6(gameObject &gameObj)
 {
 	static f32 translate_x, translate_y;
-	Player *player = dynamic_cast<Player *>(&gameObj);
+	Player *player = go_cast<Player>(&gameObj);
 	if (!player)
 		return;
 
@@ -638,7 +636,7 @@ void sword_attack_6(gameObject &gameObj)
 ***************************************************************************/
 void sword_jump_attack(gameObject &gameObj)
 {
-	Player *player = dynamic_cast<Player *>(&gameObj);
+	Player *player = go_cast<Player>(&gameObj);
 	if (!player)
 		return;
 	if (player->state != Sword_Jump_Atk.state)
@@ -683,7 +681,7 @@ void sword_jump_attack(gameObject &gameObj)
 ***************************************************************************/
 void sword_plunge(gameObject &gameObj)
 {
-	Player *player = dynamic_cast<Player *>(&gameObj);
+	Player *player = go_cast<Player>(&gameObj);
 	if (!player)
 		return;
 	if (player->state != Sword_Plunge_Atk.state)
@@ -728,7 +726,7 @@ void sword_plunge(gameObject &gameObj)
 		{
 			plunge_land_sound->play_sound();
 			particleSystem *pParticleSystem = create_particlesystem(player);
-			pParticleSystem->behaviour = slam_particle;
+			pParticleSystem->kernel = slam_particle;
 			pParticleSystem->obj_sprite->texture = pTex_dust;
 			pParticleSystem->lifetime = 0.25f;
 			pParticleSystem->emission_rate = 0.02f;
@@ -0,0 +1,256 @@
+/*!*************************************************************************
+****
+\file   transform_store.cpp
+\author agent
+\par    email: agent\@local
+\date   Oct 17 2026
+
+\brief
+This file contains the implementation of the transform store of the game
+engine.
+
+The arrays have a fixed size, so the references the game objects hold into
+them stay valid for as long as the slots are claimed. Each kind of movement
+is described by how the acceleration is applied, so every object prepared
+in a frame goes through the same branch free loop:
+	acceleration.y += gravity
+	velocity += acceleration * acc_scale
+	position += velocity * dt
+	acceleration *= acc_keep
+	bounds = position -/+ half extent
+
+The functions include:
+- get_motion
+- transform_store_claim
+- transform_store_release
+- transform_store_pos
+- transform_store_vel
+- transform_store_acc
+- transform_store_box
+- transform_store_prepare
+- transform_store_integrate
+
+Copyright (C) 2026 DigiPen Institure of Technology.
+Reproduction or disclosure of this file or its contents
+without the prior written consent of DigiPen Institute of
+Technology is prohibited.
+****************************************************************************
+***/
+#include "main.h"
+#include "transform_store.h"
+#include "attack.h"
+#include "collectables.h"
+
+static_assert(ATTACK_COLLIDER_CAPACITY + COLLECTABLE_CAPACITY <= TRANSFORM_STORE_CAPACITY,
+	"The attack collider and collectable pools do not fit in the transform store!");
+
+struct Motion
+{
+	f32 gravity;	// added to the vertical acceleration every frame
+	f32 acc_scale;	// 1 if the acceleration is added to the velocity
+	f32 acc_keep;	// 1 if the acceleration carries over to the next frame
+};
+
+// Owned by the objects holding the slots
+static AEVec2 store_pos[TRANSFORM_STORE_CAPACITY];
+static AEVec2 store_vel[TRANSFORM_STORE_CAPACITY];
+static AEVec2 store_acc[TRANSFORM_STORE_CAPACITY];
+static AABB store_box[TRANSFORM_STORE_CAPACITY];
+// Set by transform_store_prepare for the frame
+static AEVec2 store_half[TRANSFORM_STORE_CAPACITY];
+static Motion store_motion[TRANSFORM_STORE_CAPACITY];
+
+// Slots are handed out in order, and released ones are reused first
+static u32 store_free[TRANSFORM_STORE_CAPACITY];
+static u32 store_free_count;
+static u32 store_used;
+// Slots prepared since the last transform_store_integrate
+static u32 store_awake[TRANSFORM_STORE_CAPACITY];
+static u32 store_awake_count;
+
+/*!****************************************************************************
+ * @brief Gets how an object moves if it can be integrated by the store
+ *
+ * @param obj
+ * Reference to the game object
+ * @param motion
+ * Output of how its acceleration is applied
+ * @return true
+ * The object is integrated by the store
+ * @return false
+ * The object moves itself
+******************************************************************************/
+static bool get_motion(const gameObject& obj, Motion& motion)
+{
+	switch (obj.type)
+	{
+	case GO_TYPE::GO_PLAYERATTACKCOLLIDER:
+	case GO_TYPE::GO_BOSSATTACKCOLLIDER:
+		motion = { 0.0f, 1.0f, 1.0f };
+		return true;
+	case GO_TYPE::GO_ENEMYATTACKCOLLIDER:
+		// Colliders following an enemy keep their velocity, thrown ones fall
+		motion = { 0.0f, static_cast<const Attack_Collider&>(obj).owner ? 0.0f : 1.0f, 1.0f };
+		return true;
+	case GO_TYPE::GO_COLLECTABLES:
+		motion = { LEVEL_GRAVITY, 1.0f, 0.0f };
+		return true;
+	default:
+		return false;
+	}
+}
+
+/*!****************************************************************************
+ * @brief Claims a slot of the store, with its transform zeroed
+ *
+ * @return u32
+ * The slot, NO_TRANSFORM if the store is full
+******************************************************************************/
+u32 transform_store_claim()
+{
+	u32 slot;
+	if (store_free_count)
+		slot = store_free[--store_free_count];
+	else if (store_used < TRANSFORM_STORE_CAPACITY)
+		slot = store_used++;
+	else
+		return NO_TRANSFORM;
+
+	store_pos[slot] = store_vel[slot] = store_acc[slot] = AEVec2{ 0.0f, 0.0f };
+	store_box[slot] = AABB{ { 0.0f, 0.0f }, { 0.0f, 0.0f } };
+	return slot;
+}
+
+/*!****************************************************************************
+ * @brief Returns a slot to the store, called when the object holding it is
+ * destroyed
+ *
+ * @param slot
+ * Slot from transform_store_claim
+******************************************************************************/
+void transform_store_release(u32 slot)
+{
+	store_free[store_free_count++] = slot;
+	// Every slot is free again, so the next claims are in order from the start
+	if (store_free_count == store_used)
+		store_free_count = store_used = 0;
+}
+
+/*!****************************************************************************
+ * @brief Gets the position of a slot
+ *
+ * @param slot
+ * Slot from transform_store_claim
+ * @return AEVec2&
+ * Reference to the position, valid until the slot is released
+******************************************************************************/
+AEVec2& transform_store_pos(u32 slot)
+{
+	return store_pos[slot];
+}
+
+/*!****************************************************************************
+ * @brief Gets the velocity of a slot
+ *
+ * @param slot
+ * Slot from transform_store_claim
+ * @return AEVec2&
+ * Reference to the velocity, valid until the slot is released
+******************************************************************************/
+AEVec2& transform_store_vel(u32 slot)
+{
+	return store_vel[slot];
+}
+
+/*!****************************************************************************
+ * @brief Gets the acceleration of a slot
+ *
+ * @param slot
+ * Slot from transform_store_claim
+ * @return AEVec2&
+ * Reference to the acceleration, valid until the slot is released
+******************************************************************************/
+AEVec2& transform_store_acc(u32 slot)
+{
+	return store_acc[slot];
+}
+
+/*!****************************************************************************
+ * @brief Gets the bounding box of a slot
+ *
+ * @param slot
+ * Slot from transform_store_claim
+ * @return AABB&
+ * Reference to the bounding box, valid until the slot is released
+******************************************************************************/
+AABB& transform_store_box(u32 slot)
+{
+	return store_box[slot];
+}
+
+/*!****************************************************************************
+ * @brief Marks an object to be integrated by the next
+ * transform_store_integrate. Attack colliders may be rotated, so their half
+ * extent is the one of their rotated box.
+ *
+ * @param obj
+ * Reference to the game object, after its game_object_update
+ * @return true
+ * The object will be integrated and bounded by the store
+ * @return false
+ * The object has no slot or moves itself, and sets its own bounds
+******************************************************************************/
+bool transform_store_prepare(gameObject& obj)
+{
+	Motion motion;
+	if (obj.transform == NO_TRANSFORM || !get_motion(obj, motion))
+		return false;
+
+	AEVec2 half{ 0.5f * obj.scale.x, 0.5f * obj.scale.y };
+	if (obj.type != GO_TYPE::GO_COLLECTABLES && obj.obj_sprite && obj.obj_sprite->rot)
+	{
+		AEMtx33 rotation;
+		AEMtx33Rot(&rotation, obj.obj_sprite->rot);
+		AEMtx33MultVec(&half, &rotation, &half);
+		half.x = fabsf(half.x);
+		half.y = fabsf(half.y);
+	}
+
+	store_half[obj.transform] = half;
+	store_motion[obj.transform] = motion;
+	store_awake[store_awake_count++] = obj.transform;
+	return true;
+}
+
+/*!****************************************************************************
+ * @brief Integrates every object prepared since the last call and finds
+ * their bounds
+ *
+ * @param dt
+ * Time step of the frame
+******************************************************************************/
+void transform_store_integrate(f32 dt)
+{
+	for (u32 i{ 0 }; i < store_awake_count; ++i)
+	{
+		const u32 slot = store_awake[i];
+		const Motion& motion = store_motion[slot];
+		AEVec2& pos = store_pos[slot];
+		AEVec2& vel = store_vel[slot];
+		AEVec2& acc = store_acc[slot];
+		AABB& box = store_box[slot];
+
+		f32 acc_y = acc.y + motion.gravity;
+		vel.x += acc.x * motion.acc_scale;
+		vel.y += acc_y * motion.acc_scale;
+		pos.x += vel.x * dt;
+		pos.y += vel.y * dt;
+		acc.x *= motion.acc_keep;
+		acc.y = acc_y * motion.acc_keep;
+		box.min.x = pos.x - store_half[slot].x;
+		box.min.y = pos.y - store_half[slot].y;
+		box.max.x = pos.x + store_half[slot].x;
+		box.max.y = pos.y + store_half[slot].y;
+	}
+	store_awake_count = 0;
+}
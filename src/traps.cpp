@@ -12,6 +12,7 @@
 	- game_object_initialize
 	- game_object_update
 	- game_object_draw
+	- traps_get_asset
 	- traps_load
 	- traps_free
 	- traps_unload
@@ -29,9 +30,10 @@ Technology is prohibited.
 #include <iostream>
 #include "level_manager.h"
 
-static Sprite* spike_sprite;
-static Sprite* lava_sprite;
-static Sprite* icicles_sprite;
+// Loaded once in traps_load and shared by every trap of the type
+static Sprite_Asset spike_asset;
+static Sprite_Asset lava_asset;
+static Sprite_Asset icicles_asset;
 static gameObject* traps_obj;
 
 AEGfxVertexList* mesh_traps = 0;
@@ -44,7 +46,7 @@ AEGfxTexture* tex_traps_icicles;
 	Default constructor of the traps
 	Default trap: killzone
 *******************************************************************************/
-Traps::Traps() : gameObject(), damage(100)
+Traps::Traps() : gameObject(), damage(100), sprite_asset(nullptr), render_state()
 {
 	on_collide = traps_collide;
 	type = GO_TYPE::GO_TRAPS;
@@ -58,13 +60,12 @@ Traps::Traps() : gameObject(), damage(100)
   \brief
 	Parameterized traps constructor
 *******************************************************************************/
-Traps::Traps(AEVec2 init_pos, AEVec2 scale, TRAPS_TYPE traps_type, Sprite* spr)
-	:damage(100)
+Traps::Traps(AEVec2 init_pos, AEVec2 scale, TRAPS_TYPE traps_type)
+	:damage(100), sprite_asset(traps_get_asset(traps_type)), render_state()
 {
 	type = GO_TYPE::GO_TRAPS;
 	this->init_pos = init_pos;
 	this->scale = scale;
-	this->obj_sprite = spr;
 	this->traps_type = traps_type;
 }
 
@@ -76,19 +77,18 @@ SpikeTraps::SpikeTraps() : Traps()
 {
 	this->damage = 1;
 	traps_type = TRAPS_TYPE::TRAPS_SPIKE;
-	obj_sprite = new Sprite(tex_traps_spike, mesh_traps, { 50.0f,50.0f });
+	sprite_asset = &spike_asset;
 }
 
 /*!*****************************************************************************
   \brief
 	Parameterized spikes constructor
 *******************************************************************************/
-SpikeTraps::SpikeTraps(AEVec2 init_pos, AEVec2 scale, TRAPS_TYPE traps_type, Sprite* spr)
-	: Traps(init_pos, scale, traps_type, spr)
+SpikeTraps::SpikeTraps(AEVec2 init_pos, AEVec2 scale, TRAPS_TYPE traps_type)
+	: Traps(init_pos, scale, traps_type)
 {
 	this->damage = 1;
 	traps_type = TRAPS_TYPE::TRAPS_SPIKE;
-	obj_sprite = new Sprite(tex_traps_spike, mesh_traps, { 50.0f,50.0f });
 }
 
 /*!*****************************************************************************
@@ -98,7 +98,7 @@ SpikeTraps::SpikeTraps(AEVec2 init_pos, AEVec2 scale, TRAPS_TYPE traps_type, Spr
 LavaTraps::LavaTraps() : Traps()
 {
 	this->damage = 1;
-	obj_sprite = new Sprite(tex_traps_lava, mesh_traps, { 50.0f,50.0f });
+	sprite_asset = &lava_asset;
 	traps_type = TRAPS_TYPE::TRAPS_FIRE;
 }
 
@@ -106,11 +106,10 @@ LavaTraps::LavaTraps() : Traps()
   \brief
 	Parameterized lava traps constructor
 *******************************************************************************/
-LavaTraps::LavaTraps(AEVec2 init_pos, AEVec2 scale, TRAPS_TYPE traps_type, Sprite* spr)
-	: Traps(init_pos, scale, traps_type, spr)
+LavaTraps::LavaTraps(AEVec2 init_pos, AEVec2 scale, TRAPS_TYPE traps_type)
+	: Traps(init_pos, scale, traps_type)
 {
 	this->damage = 1;
-	obj_sprite = new Sprite(tex_traps_lava, mesh_traps, { 50.0f,50.0f });
 	traps_type = TRAPS_TYPE::TRAPS_FIRE;
 }
 
@@ -121,7 +120,7 @@ LavaTraps::LavaTraps(AEVec2 init_pos, AEVec2 scale, TRAPS_TYPE traps_type, Sprit
 IciclesTraps::IciclesTraps() : Traps(), outer_bound()
 {
 	this->damage = 1;
-	obj_sprite = new Sprite(tex_traps_icicles, mesh_traps, { 50.0f,50.0f });
+	sprite_asset = &icicles_asset;
 	traps_type = TRAPS_TYPE::TRAPS_ICICLES;
 	on_collide = traps_collide;
 }
@@ -130,11 +129,10 @@ IciclesTraps::IciclesTraps() : Traps(), outer_bound()
   \brief
 	Parameterized icicles traps constructor
 *******************************************************************************/
-IciclesTraps::IciclesTraps(AEVec2 init_pos, AEVec2 scale, TRAPS_TYPE traps_type, Sprite* spr)
-	: Traps(init_pos, scale, traps_type, spr), outer_bound()
+IciclesTraps::IciclesTraps(AEVec2 init_pos, AEVec2 scale, TRAPS_TYPE traps_type)
+	: Traps(init_pos, scale, traps_type), outer_bound()
 {
 	this->damage = 1;
-	obj_sprite = new Sprite(tex_traps_icicles, mesh_traps, { 50.0f,50.0f });
 	traps_type = TRAPS_TYPE::TRAPS_ICICLES;
 	on_collide = traps_collide;
 }
@@ -145,10 +143,6 @@ IciclesTraps::IciclesTraps(AEVec2 init_pos, AEVec2 scale, TRAPS_TYPE traps_type,
 *******************************************************************************/
 Traps::~Traps()
 {
-	if (traps_type != TRAPS_TYPE::TRAPS_KILLZONE)
-	{
-		delete obj_sprite;
-	}
 }
 
 /*!*****************************************************************************
@@ -187,7 +181,33 @@ void IciclesTraps::set_aabb()
 
 /*!*****************************************************************************
   \brief
-	This function loads all the assets for traps
+	This function gets the sprite asset shared by the traps of a type
+
+  \param traps_type
+	Type of the trap
+
+  \return
+	The sprite asset, or nullptr for killzones which have none
+*******************************************************************************/
+const Sprite_Asset* traps_get_asset(TRAPS_TYPE traps_type)
+{
+	switch (traps_type)
+	{
+	case TRAPS_TYPE::TRAPS_SPIKE:
+		return &spike_asset;
+	case TRAPS_TYPE::TRAPS_FIRE:
+		return &lava_asset;
+	case TRAPS_TYPE::TRAPS_ICICLES:
+		return &icicles_asset;
+	default:
+		return nullptr;
+	}
+}
+
+/*!*****************************************************************************
+  \brief
+	This function loads all the assets for traps. The size of each texture is
+	read here once, instead of every time a trap is drawn.
 *******************************************************************************/
 void traps_load()
 {
@@ -195,12 +215,15 @@ void traps_load()
 	//spikes
 	tex_traps_spike = AEGfxTextureLoad("./Sprites/spikes.png");
 	AE_ASSERT_MESG(tex_traps_spike, "Failed to create traps texture!!");
+	spike_asset = { tex_traps_spike, mesh_traps, read_png_size("./Sprites/spikes.png"), { 50.0f, 50.0f } };
 
 	tex_traps_lava = AEGfxTextureLoad("./Sprites/lava_trap.png");
-	AE_ASSERT_MESG(tex_traps_spike, "Failed to create traps texture!!");
+	AE_ASSERT_MESG(tex_traps_lava, "Failed to create traps texture!!");
+	lava_asset = { tex_traps_lava, mesh_traps, read_png_size("./Sprites/lava_trap.png"), { 50.0f, 50.0f } };
 
 	tex_traps_icicles = AEGfxTextureLoad("./Sprites/icicles_trap.png");
-	AE_ASSERT_MESG(tex_traps_spike, "Failed to create traps texture!!");
+	AE_ASSERT_MESG(tex_traps_icicles, "Failed to create traps texture!!");
+	icicles_asset = { tex_traps_icicles, mesh_traps, read_png_size("./Sprites/icicles_trap.png"), { 50.0f, 50.0f } };
 }
 
 /*!*****************************************************************************
@@ -217,9 +240,7 @@ void traps_free()
 *******************************************************************************/
 void traps_unload()
 {
-	delete spike_sprite;
-	delete lava_sprite;
-	delete icicles_sprite;
+	spike_asset = lava_asset = icicles_asset = Sprite_Asset();
 	AEGfxMeshFree(mesh_traps);
 	AEGfxTextureUnload(tex_traps_spike);
 	AEGfxTextureUnload(tex_traps_lava);
@@ -243,7 +264,7 @@ void Traps::game_object_update()
 {
 	if (traps_type == TRAPS_TYPE::TRAPS_ICICLES)
 	{
-		IciclesTraps* tmp = dynamic_cast<IciclesTraps*>(this);
+		IciclesTraps* tmp = go_cast<IciclesTraps>(this);
 		if (Level::player->curr_pos.x > tmp->outer_bound.min.x
 			&& Level::player->curr_pos.x < tmp->outer_bound.max.x
 			&& Level::player->curr_pos.y > tmp->outer_bound.min.y
@@ -254,7 +275,7 @@ void Traps::game_object_update()
 			{
 				this->flag = false;
 			}*/
-			obj_sprite->tint = { 1.0f, 0.0f, 0.1f, 1.0f };
+			render_state.tint = { 1.0f, 0.0f, 0.1f, 1.0f };
 		}
 		AEVec2Add(&curr_vel, &curr_vel, &acceleration);
 		AEVec2 dt_vel;
@@ -269,31 +290,10 @@ void Traps::game_object_update()
 *******************************************************************************/
 void Traps::game_object_draw()
 {
-	if (traps_type == TRAPS_TYPE::TRAPS_SPIKE)
-	{
-		obj_sprite->mesh = mesh_traps;
-		obj_sprite->texture = tex_traps_spike;
-		obj_sprite->set_size(read_png_size("./Sprites/spikes.png"));
-		draw(obj_sprite, curr_pos, scale);
-	}
-	if (traps_type == TRAPS_TYPE::TRAPS_KILLZONE)
-	{
+	if (sprite_asset)
+		draw(*sprite_asset, render_state, curr_pos, scale);
+	else
 		draw(nullptr, curr_pos, scale);
-	}
-	if (traps_type == TRAPS_TYPE::TRAPS_FIRE)
-	{
-		obj_sprite->mesh = mesh_traps;
-		obj_sprite->texture = tex_traps_lava;
-		obj_sprite->set_size(read_png_size("./Sprites/lava_trap.png"));
-		draw(obj_sprite, curr_pos, scale);
-	}
-	if (traps_type == TRAPS_TYPE::TRAPS_ICICLES)
-	{
-		obj_sprite->mesh = mesh_traps;
-		obj_sprite->texture = tex_traps_icicles;
-		obj_sprite->set_size(read_png_size("./Sprites/icicles_trap.png"));
-		draw(obj_sprite, curr_pos, scale);
-	}
 }
 
 /*!*****************************************************************************
@@ -303,17 +303,17 @@ void Traps::game_object_draw()
 *******************************************************************************/
 void traps_collide(gameObject& traps_obj)
 {
-	Traps* traps = dynamic_cast<Traps*>(&traps_obj);
-	vector<gameObject*>& colliders = traps_obj.colliders;
+	Traps* traps = go_cast<Traps>(&traps_obj);
+	Collider_List& colliders = traps_obj.colliders;
 
-	for (vector<gameObject*>::iterator i = colliders.begin(); i != colliders.end(); ++i)
+	for (Collider_List::iterator i = colliders.begin(); i != colliders.end(); ++i)
 	{
 		gameObject& obj_col = **i;
 
 		if (((obj_col.type == GO_TYPE::GO_PLATFORM) && (traps->traps_type == TRAPS_TYPE::TRAPS_ICICLES)) ||
 			((obj_col.type == GO_TYPE::GO_PLAYER) && (traps->traps_type == TRAPS_TYPE::TRAPS_ICICLES)))
 		{
-			traps->flag = false;
+			destroy_object(traps);
 		}
 	}
 }
\ No newline at end of file
@@ -107,7 +107,8 @@ void tutorial_initialize()
 
 /******************************************************************************
  * @brief Update function of the tutorial game state
- * Updates the level and its objects as well as updating the collisions. 
+ * Updates the level and its objects as well as updating the collisions, and 
+ * deletes the destroyed objects.
  * In addition, if the player parries in the area 1 (parry tutorial), 
  * clear the area. If the player's position is past 6000 (the exit door), win 
  * the level. Accomodate for pause as well.
@@ -121,6 +122,7 @@ void tutorial_update()
 		level->update();
 		level_objects_update(level->v_gameObjects);
 		collision_update(level->v_gameObjects);
+		compact_objects(level->v_gameObjects);
 		if (level->current_area == 1 && level->player->parry)
 		{
 			level->clear_area(1);